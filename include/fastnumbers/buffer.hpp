@@ -1,10 +1,123 @@
 #pragma once
 
+#include <cstddef>
 #include <cstring>
 #include <limits>
+#include <utility>
 
 #include "fastnumbers/c_str_parsing.hpp"
 
+/**
+ * \class ScratchPool
+ * \brief A per-thread cache of the storage used by large Buffers
+ *
+ * Storage that a Buffer no longer needs is kept for the next Buffer
+ * instead of being returned to the allocator. Once the longest input of
+ * a call has been seen, converting more data does not allocate at all.
+ */
+class ScratchPool {
+public:
+    /**
+     * \brief Obtain storage for at least the given number of characters
+     * \param needed The number of characters that are needed
+     * \param size The number of characters the storage can hold
+     * \return The storage, which must be given back with release()
+     */
+    static char* acquire(const std::size_t needed, std::size_t& size) noexcept(false)
+    {
+        // Use the smallest stored block that is large enough
+        Blocks& blocks = local_blocks();
+        std::size_t best = blocks.count;
+        for (std::size_t i = 0; i < blocks.count; ++i) {
+            const bool fits = blocks.size[i] >= needed;
+            if (fits && (best == blocks.count || blocks.size[i] < blocks.size[best])) {
+                best = i;
+            }
+        }
+        if (best != blocks.count) {
+            char* data = blocks.data[best];
+            size = blocks.size[best];
+            blocks.count -= 1;
+            blocks.data[best] = blocks.data[blocks.count];
+            blocks.size[best] = blocks.size[blocks.count];
+            return data;
+        }
+
+        // Round up to a power of two so that the storage is more reusable
+        size = needed > MAX_KEPT_SIZE ? needed : MIN_BLOCK_SIZE;
+        while (size < needed) {
+            size *= 2;
+        }
+        return new char[size];
+    }
+
+    /**
+     * \brief Give back storage obtained with acquire()
+     * \param data The storage, may be nullptr
+     * \param size The number of characters the storage can hold
+     */
+    static void release(char* data, const std::size_t size) noexcept
+    {
+        if (data == nullptr) {
+            return;
+        }
+
+        // Keep the storage unless it is excessively large. If there is
+        // no room, it replaces the smallest block if it is larger.
+        Blocks& blocks = local_blocks();
+        if (size <= MAX_KEPT_SIZE) {
+            if (blocks.count < MAX_BLOCKS) {
+                blocks.data[blocks.count] = data;
+                blocks.size[blocks.count] = size;
+                blocks.count += 1;
+                return;
+            }
+            std::size_t smallest = 0;
+            for (std::size_t i = 1; i < blocks.count; ++i) {
+                if (blocks.size[i] < blocks.size[smallest]) {
+                    smallest = i;
+                }
+            }
+            if (blocks.size[smallest] < size) {
+                std::swap(data, blocks.data[smallest]);
+                blocks.size[smallest] = size;
+            }
+        }
+        delete[] data;
+    }
+
+private:
+    /// The smallest block of storage that will be created
+    static constexpr std::size_t MIN_BLOCK_SIZE = 64;
+
+    /// Storage larger than this is returned to the allocator
+    static constexpr std::size_t MAX_KEPT_SIZE = 1 << 20;
+
+    /// The number of blocks of storage that are kept
+    static constexpr std::size_t MAX_BLOCKS = 8;
+
+    /// The storage kept by a thread
+    struct Blocks {
+        char* data[MAX_BLOCKS] = {};
+        std::size_t size[MAX_BLOCKS] = {};
+        std::size_t count = 0;
+
+        ~Blocks() noexcept
+        {
+            for (std::size_t i = 0; i < count; ++i) {
+                delete[] data[i];
+            }
+        }
+    };
+
+    /// The storage kept by the current thread
+    static Blocks& local_blocks() noexcept
+    {
+        thread_local Blocks blocks;
+        return blocks;
+    }
+};
+
 /**
  * \class Buffer
  * \brief A buffer of character data
@@ -20,6 +133,7 @@ public:
     explicit Buffer(const std::size_t needed_length)
         : m_fixed_buffer()
         , m_variable_buffer(nullptr)
+        , m_variable_size(0)
         , m_buffer(nullptr)
         , m_len(needed_length)
         , m_size(0)
@@ -37,7 +151,7 @@ public:
     Buffer(const Buffer&) = delete;
     Buffer(Buffer&&) = delete;
     Buffer& operator=(const Buffer&) = delete;
-    ~Buffer() noexcept { delete[] m_variable_buffer; };
+    ~Buffer() noexcept { ScratchPool::release(m_variable_buffer, m_variable_size); };
 
     /// Restore the Buffer to an empty-like state
     void reset() noexcept
@@ -128,6 +242,9 @@ private:
     /// A string buffer of variable size, in case large data must be copied
     char* m_variable_buffer;
 
+    /// The number of characters the variable size buffer can hold
+    std::size_t m_variable_size;
+
     /// Pointer to the character buffer being used
     char* m_buffer;
 
@@ -148,8 +265,14 @@ private:
             if (m_size < FIXED_BUFFER_SIZE) {
                 m_buffer = m_fixed_buffer;
             } else {
-                delete[] m_variable_buffer;
-                m_variable_buffer = new char[m_size];
+                // Large data uses storage from the thread's pool, which is
+                // only replaced if it cannot hold the data
+                if (m_size > m_variable_size) {
+                    ScratchPool::release(m_variable_buffer, m_variable_size);
+                    m_variable_buffer = nullptr;
+                    m_variable_size = 0;
+                    m_variable_buffer = ScratchPool::acquire(m_size, m_variable_size);
+                }
                 m_buffer = m_variable_buffer;
             }
         }
@@ -0,0 +1,211 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <variant>
+
+#include <Python.h>
+
+#include "fastnumbers/payload.hpp"
+
+/**
+ * \class InputCache
+ * \brief Remember the result of parsing strings that have been seen before
+ *
+ * Data often contains only a few distinct strings repeated many times
+ * (e.g. status codes or bucketed values). This cache allows repeated
+ * strings to skip parsing altogether.
+ *
+ * The cache is direct-mapped on the string hash, so a new string simply
+ * replaces whatever occupied its slot. Only exact str objects are cached
+ * because Python stores their hash, and because the parse result of a
+ * str depends only on its contents. If too few lookups are hits, the
+ * cache disables itself so that unique data only pays for the hashing
+ * of the first few elements. The hit rate is only counted for that
+ * decision, and is not reported to the user.
+ *
+ * \tparam ValueType The parse result to remember, a Payload or RawPayload
+ */
+template <typename ValueType>
+class InputCache {
+public:
+    /// The number of slots in the cache, must be a power of two
+    static constexpr std::size_t NUM_SLOTS = 2048;
+
+    /// How many lookups to perform between checks of the hit rate
+    static constexpr std::size_t CHECK_INTERVAL = 1024;
+
+    /// The hit rate (in percent) below which the cache is disabled
+    static constexpr std::size_t MIN_HIT_PERCENT = 25;
+
+    /// Construct an empty cache - no memory is allocated until needed
+    InputCache() noexcept
+        : m_slots(nullptr)
+        , m_enabled(true)
+        , m_window_hits(0)
+        , m_window_lookups(0)
+    { }
+
+    // Copying and moving not allowed - the slots own Python references
+    InputCache(const InputCache&) = delete;
+    InputCache(InputCache&&) = delete;
+    InputCache& operator=(const InputCache&) = delete;
+    InputCache& operator=(InputCache&&) = delete;
+
+    /// Destruct, releasing all stored Python references
+    ~InputCache() noexcept { clear(); }
+
+    /**
+     * \brief Look for the stored parse result of the given object
+     *
+     * If the stored value holds a Python object the cache keeps its own
+     * reference, so the caller must increment it if it is given away.
+     *
+     * \param input The object about to be parsed
+     * \return The stored parse result, or nullptr if it was not found
+     */
+    const ValueType* find(PyObject* input) noexcept
+    {
+        if (!m_enabled || !PyUnicode_CheckExact(input)) {
+            return nullptr;
+        }
+
+        const Py_hash_t hash = PyObject_Hash(input);
+        if (hash == -1) {
+            PyErr_Clear();
+            return nullptr;
+        }
+
+        const Slot* slot = m_slots ? &m_slots[slot_index(hash)] : nullptr;
+        const bool found = slot != nullptr && slot->key != nullptr
+            && (slot->key == input
+                || (slot->hash == hash
+                    && slot->length == PyUnicode_GET_LENGTH(input)
+                    && PyUnicode_Compare(slot->key, input) == 0));
+        record(found);
+        return found && m_enabled ? &slot->value : nullptr;
+    }
+
+    /**
+     * \brief Store the parse result of the given object
+     *
+     * Objects that cannot be cached, and Payloads that do not hold a
+     * result (i.e. nullptr), are ignored.
+     *
+     * \param input The object that was parsed
+     * \param value The parse result
+     */
+    void insert(PyObject* input, const ValueType& value) noexcept(false)
+    {
+        if (!m_enabled || !PyUnicode_CheckExact(input) || !is_storable(value)) {
+            return;
+        }
+
+        const Py_hash_t hash = PyObject_Hash(input);
+        if (hash == -1) {
+            PyErr_Clear();
+            return;
+        }
+
+        if (!m_slots) {
+            m_slots = std::make_unique<Slot[]>(NUM_SLOTS);
+        }
+        Slot& slot = m_slots[slot_index(hash)];
+        release(slot);
+        Py_INCREF(input);
+        slot.key = input;
+        slot.hash = hash;
+        slot.length = PyUnicode_GET_LENGTH(input);
+        slot.value = value;
+        retain(slot.value);
+    }
+
+private:
+    /// A stored parse result and the string it belongs to
+    struct Slot {
+        PyObject* key = nullptr;
+        Py_hash_t hash = 0;
+        Py_ssize_t length = 0;
+        ValueType value {};
+    };
+
+    /// The slots, allocated on the first insertion
+    std::unique_ptr<Slot[]> m_slots;
+
+    /// Whether or not the cache is still in use
+    bool m_enabled;
+
+    /// Hits since the last check of the hit rate
+    std::size_t m_window_hits;
+
+    /// Lookups since the last check of the hit rate
+    std::size_t m_window_lookups;
+
+private:
+    /// The slot a hash maps to
+    static std::size_t slot_index(const Py_hash_t hash) noexcept
+    {
+        return static_cast<std::size_t>(hash) & (NUM_SLOTS - 1);
+    }
+
+    /// Update the hit rate, and disable the cache if it is not useful
+    void record(const bool hit) noexcept
+    {
+        m_window_hits += hit;
+        m_window_lookups += 1;
+        if (m_window_lookups == CHECK_INTERVAL) {
+            if (m_window_hits * 100 < MIN_HIT_PERCENT * CHECK_INTERVAL) {
+                m_enabled = false;
+                clear();
+            }
+            m_window_hits = 0;
+            m_window_lookups = 0;
+        }
+    }
+
+    /// Release all stored Python references and the slots
+    void clear() noexcept
+    {
+        if (m_slots) {
+            for (std::size_t i = 0; i < NUM_SLOTS; ++i) {
+                release(m_slots[i]);
+            }
+            m_slots.reset();
+        }
+    }
+
+    /// Release the Python references held by a slot
+    static void release(Slot& slot) noexcept
+    {
+        if (slot.key != nullptr) {
+            if constexpr (std::is_same_v<ValueType, Payload>) {
+                if (PyObject* const* obj = std::get_if<PyObject*>(&slot.value)) {
+                    Py_XDECREF(*obj);
+                }
+            }
+            Py_DECREF(slot.key);
+            slot.key = nullptr;
+        }
+    }
+
+    /// Obtain a reference to any Python object a stored value holds
+    static void retain(const ValueType& value) noexcept
+    {
+        if constexpr (std::is_same_v<ValueType, Payload>) {
+            if (PyObject* const* obj = std::get_if<PyObject*>(&value)) {
+                Py_INCREF(*obj);
+            }
+        }
+    }
+
+    /// Whether or not a value represents a result worth storing
+    static bool is_storable(const ValueType& value) noexcept
+    {
+        if constexpr (std::is_same_v<ValueType, Payload>) {
+            const PyObject* const* obj = std::get_if<PyObject*>(&value);
+            return obj == nullptr || *obj != nullptr;
+        }
+        return true;
+    }
+};
@@ -0,0 +1,297 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <utility>
+#include <variant>
+
+#include <Python.h>
+
+#include "fastnumbers/ctype_extractor.hpp"
+#include "fastnumbers/exception.hpp"
+#include "fastnumbers/iteration.hpp"
+#include "fastnumbers/parser.hpp"
+#include "fastnumbers/payload.hpp"
+#include "fastnumbers/user_options.hpp"
+
+/**
+ * \brief Call a function with a value of the C number type of an array format
+ * \param format The struct-module-like format of an array buffer
+ * \param func Function accepting a (default-initialized) C number
+ * \return false if the format is not that of a supported C number type
+ */
+template <typename Function>
+bool visit_ctype(const std::string_view format, Function func) noexcept(false)
+{
+    // Attempt to order this if-branch by anticipated frequency of use
+    if (format == "d") {
+        func(double {});
+    } else if (format == "l") {
+        func(static_cast<signed long>(0));
+    } else if (format == "q") {
+        func(static_cast<signed long long>(0));
+    } else if (format == "i") {
+        func(static_cast<signed int>(0));
+    } else if (format == "f") {
+        func(float {});
+    } else if (format == "L") {
+        func(static_cast<unsigned long>(0));
+    } else if (format == "Q") {
+        func(static_cast<unsigned long long>(0));
+    } else if (format == "I") {
+        func(static_cast<unsigned int>(0));
+    } else if (format == "h") {
+        func(static_cast<signed short>(0));
+    } else if (format == "b") {
+        func(static_cast<signed char>(0));
+    } else if (format == "H") {
+        func(static_cast<unsigned short>(0));
+    } else if (format == "B") {
+        func(static_cast<unsigned char>(0));
+    } else {
+        return false;
+    }
+    return true;
+}
+
+/**
+ * \brief Call a function with a value of the C number type of an array buffer
+ *
+ * Unlike the format alone, this accepts formats with an explicit native
+ * byte order (as given for the fields of packed record arrays), and checks
+ * that the size of the elements matches the C number type.
+ *
+ * \param view The array buffer, which must have been requested with its format
+ * \param func Function accepting a (default-initialized) C number
+ * \return false if the buffer is not of a supported C number type
+ */
+template <typename Function>
+bool visit_ctype(const Py_buffer& view, Function func) noexcept(false)
+{
+    std::string_view format = view.format == nullptr ? "<NULL>" : view.format;
+    constexpr std::string_view native_orders = PY_LITTLE_ENDIAN ? "@=<" : "@=>";
+    if (format.size() > 1 && native_orders.find(format.front()) != format.npos) {
+        format.remove_prefix(1);
+    }
+
+    bool matched = false;
+    visit_ctype(format, [&](auto value) {
+        if (view.itemsize == static_cast<Py_ssize_t>(sizeof(value))) {
+            matched = true;
+            func(value);
+        }
+    });
+    return matched;
+}
+
+/**
+ * \class WritableBuffer
+ * \brief Writable view of the memory of a Python array
+ */
+class WritableBuffer {
+public:
+    /**
+     * \brief View the memory of the given object
+     * \param obj The Python object to view
+     * \throws exception_is_set if the object does not support the buffer protocol
+     */
+    explicit WritableBuffer(PyObject* obj) noexcept(false)
+        : m_view { nullptr, nullptr }
+    {
+        constexpr auto flags = PyBUF_WRITABLE | PyBUF_STRIDES | PyBUF_FORMAT;
+        if (PyObject_GetBuffer(obj, &m_view, flags) != 0) {
+            throw exception_is_set();
+        }
+    }
+
+    // Cannot copy
+    WritableBuffer(const WritableBuffer&) = delete;
+    WritableBuffer(WritableBuffer&&) = delete;
+    WritableBuffer& operator=(const WritableBuffer&) = delete;
+
+    /// Release the buffer
+    ~WritableBuffer() noexcept { PyBuffer_Release(&m_view); }
+
+    /// The buffer
+    Py_buffer& view() noexcept { return m_view; }
+
+    /// The format of the elements of the buffer
+    std::string_view format() const noexcept
+    {
+        return m_view.format == nullptr ? "<NULL>" : m_view.format;
+    }
+
+private:
+    /// The viewed buffer
+    Py_buffer m_view;
+};
+
+/// The user's replacement actions for one column
+struct Replacements {
+    PyObject* inf;
+    PyObject* nan;
+    PyObject* on_fail;
+    PyObject* on_overflow;
+    PyObject* on_type_error;
+};
+
+/**
+ * \class Column
+ * \brief One output array of a conversion that fills several arrays at once
+ *
+ * Each array may have a different C number type, which is hidden behind
+ * this interface so that the columns of a record can be filled in a loop.
+ */
+class Column {
+public:
+    Column() = default;
+    Column(const Column&) = delete;
+    Column(Column&&) = delete;
+    Column& operator=(const Column&) = delete;
+    virtual ~Column() = default;
+
+    /**
+     * \brief Parse text into a row without touching the Python interpreter
+     * \param text The text to parse
+     * \param row The row of the array to fill
+     * \return false if handling the result needs the Python object of
+     *         the text, in which case resolve() must be called instead
+     */
+    virtual bool parse(std::string_view text, Py_ssize_t row) noexcept(false) = 0;
+
+    /**
+     * \brief Parse text into a row, applying the user's replacement actions
+     * \param text The text to parse
+     * \param item The text as a Python object
+     * \param row The row of the array to fill
+     * \return false if a Python exception is set
+     */
+    virtual bool resolve(std::string_view text, PyObject* item, Py_ssize_t row)
+        noexcept(false)
+        = 0;
+
+    /**
+     * \brief Convert a Python object into a row, applying the replacement actions
+     * \param item The object to convert
+     * \param row The row of the array to fill
+     * \return false if a Python exception is set
+     */
+    virtual bool convert(PyObject* item, Py_ssize_t row) noexcept(false) = 0;
+};
+
+/**
+ * \class TypedColumn
+ * \brief A Column containing a specific C number type
+ *
+ * If a validity mask is given, the rows for which the input could not
+ * be converted (i.e. on_fail, on_overflow or on_type_error was used)
+ * are set to false in the mask. The other rows of the mask are not set.
+ *
+ * \tparam T The C number type of the array
+ */
+template <typename T>
+class TypedColumn : public Column {
+public:
+    /**
+     * \brief Prepare to fill an array
+     * \param output The view of the array to fill
+     * \param mask The validity mask of the array to fill, or None or nullptr
+     * \param rows The number of rows the array must have
+     * \param options The options of the conversion
+     * \param replacements The user's replacement actions
+     */
+    TypedColumn(
+        std::unique_ptr<WritableBuffer> output,
+        PyObject* mask,
+        const Py_ssize_t rows,
+        const UserOptions& options,
+        const Replacements& replacements
+    ) noexcept(false)
+        : Column()
+        , m_buffer(std::move(output))
+        , m_output(m_buffer->view(), rows)
+        , m_mask_buffer()
+        , m_mask()
+        , m_options(options)
+        , m_extractor(options)
+    {
+        m_extractor.set_inf_replacement(replacements.inf);
+        m_extractor.set_nan_replacement(replacements.nan);
+        m_extractor.set_fail_replacement(replacements.on_fail);
+        m_extractor.set_overflow_replacement(replacements.on_overflow);
+        m_extractor.set_type_error_replacement(replacements.on_type_error);
+        if (mask != nullptr && mask != Py_None) {
+            m_mask_buffer = std::make_unique<WritableBuffer>(mask);
+            m_mask.emplace(m_mask_buffer->view(), rows);
+        }
+    }
+
+    bool parse(std::string_view text, Py_ssize_t row) noexcept(false) override
+    {
+        const RawPayload<T> payload = parse_text(text);
+        if (m_extractor.needs_resolution(payload)) {
+            return false;
+        }
+        m_output.place_at(row, std::get<T>(payload));
+        return true;
+    }
+
+    bool resolve(std::string_view text, PyObject* item, Py_ssize_t row)
+        noexcept(false) override
+    {
+        return place(parse_text(text), item, row);
+    }
+
+    bool convert(PyObject* item, Py_ssize_t row) noexcept(false) override
+    {
+        return place(m_extractor.parse_object(item, m_options), item, row);
+    }
+
+private:
+    /// The array to fill
+    std::unique_ptr<WritableBuffer> m_buffer;
+
+    /// The handler for inserting data into the array
+    ArrayPopulator m_output;
+
+    /// The validity mask to fill, if any
+    std::unique_ptr<WritableBuffer> m_mask_buffer;
+
+    /// The handler for inserting data into the validity mask, if any
+    std::optional<ArrayPopulator> m_mask;
+
+    /// The options of the conversion
+    UserOptions m_options;
+
+    /// The converter that handles invalid results
+    CTypeExtractor<T> m_extractor;
+
+private:
+    /// Parse text without any error handling
+    RawPayload<T> parse_text(const std::string_view text) const noexcept(false)
+    {
+        return m_extractor.parse(
+            CharacterParser(text.data(), text.size(), m_options), m_options
+        );
+    }
+
+    /// Place a result in a row, applying the user's replacement actions
+    bool place(const RawPayload<T>& payload, PyObject* item, const Py_ssize_t row)
+        noexcept(false)
+    {
+        if (!m_extractor.needs_resolution(payload)) {
+            m_output.place_at(row, std::get<T>(payload));
+            return true;
+        }
+        const std::optional<T> value = m_extractor.resolve(payload, item);
+        if (!value) {
+            return false;
+        }
+        m_output.place_at(row, *value);
+        if (m_mask && std::holds_alternative<ErrorType>(payload)) {
+            m_mask->place_at(row, false);
+        }
+        return true;
+    }
+};
@@ -2,6 +2,7 @@
 
 #include <cmath>
 #include <map>
+#include <optional>
 #include <type_traits>
 #include <utility>
 #include <variant>
@@ -9,6 +10,7 @@
 #include <Python.h>
 
 #include "fastnumbers/compatibility.hpp"
+#include "fastnumbers/deferred.hpp"
 #include "fastnumbers/exception.hpp"
 #include "fastnumbers/extractor.hpp"
 #include "fastnumbers/helpers.hpp"
@@ -21,6 +23,10 @@
 /**
  * \class CTypeExtractor
  * \brief Extract the requested C numeric type from a Python object
+ *
+ * So that converting each element does not throw, a failed conversion
+ * (e.g. the user asked for an error to be raised) is returned as
+ * std::nullopt with a Python exception set.
  */
 template <typename T>
 class CTypeExtractor {
@@ -34,6 +40,7 @@ public:
         , m_type_error()
         , m_options(options)
         , m_buffer()
+        , m_deferred(nullptr)
     { }
 
     // Copy and assignment are disallowed
@@ -47,23 +54,126 @@ public:
     /**
      * \brief Return a C number in the requested type
      * \param input The Python object from which to extract the number
-     * \return The C number in the template type specified
-     * \throw exception_is_set If a Python exception is set and needs to be raised
+     * \return The C number in the template type specified, or std::nullopt
+     *         if a Python exception is set
+     */
+    std::optional<T> extract_c_number(PyObject* input) noexcept(false)
+    {
+        return extract_c_number(input, m_options);
+    }
+
+    /**
+     * \brief Return a C number in the requested type
+     * \param input The Python object from which to extract the number
+     * \param options The stored options, which may be a FixedOptions
+     * \return The C number in the template type specified, or std::nullopt
+     *         if a Python exception is set
+     */
+    template <typename OptionsT>
+    std::optional<T>
+    extract_c_number(PyObject* input, const OptionsT& options) noexcept(false)
+    {
+        return resolve(parse_object(input, options), input);
+    }
+
+    /**
+     * \brief Parse a Python object into a C number without any error handling
+     * \param input The Python object from which to extract the number
+     * \param options The stored options, which may be a FixedOptions
+     * \return The C number in the template type specified, or the error
      */
-    T extract_c_number(PyObject* input) noexcept(false)
+    template <typename OptionsT>
+    RawPayload<T> parse_object(PyObject* input, const OptionsT& options) noexcept(false)
     {
-        // Get the payload no matter which parser was returned
+        return parse(extract_parser(input, m_buffer, m_options), options);
+    }
+
+    /**
+     * \brief Parse a C number in the requested type without any error handling
+     *
+     * The Python interpreter is not touched for character or unicode
+     * parsers, so this may be called without holding the GIL in those cases.
+     *
+     * \param parser The parser containing the data to convert
+     * \return The C number in the template type specified, or the error
+     */
+    RawPayload<T> parse(const AnyParser& parser) const noexcept(false)
+    {
+        return parse(parser, m_options);
+    }
+
+    /**
+     * \brief Parse a C number in the requested type without any error handling
+     * \param parser The parser containing the data to convert
+     * \param options The stored options, which may be a FixedOptions
+     * \return The C number in the template type specified, or the error
+     */
+    template <typename OptionsT>
+    RawPayload<T> parse(const AnyParser& parser, const OptionsT& options) const
+        noexcept(false)
+    {
+        // Get the payload no matter which parser was returned.
+        // Only parsing characters depends on the options.
         RawPayload<T> payload;
         std::visit(
-            [&payload](const auto& parser) {
-                parser.as_number(payload);
+            [&payload, &options](const auto& parser) {
+                using ParserT = std::decay_t<decltype(parser)>;
+                if constexpr (std::is_same_v<ParserT, CharacterParser>) {
+                    parser.as_number(payload, options);
+                } else {
+                    parser.as_number(payload);
+                }
             },
-            extract_parser(input, m_buffer, m_options)
+            parser
         );
+        return payload;
+    }
 
+    /**
+     * \brief Determine if a parsed payload must be passed through resolve()
+     *
+     * If this is false, the payload holds a valid C number that needs no
+     * replacement and resolve() need not be called (nor the input object created).
+     *
+     * \param payload The result of parse()
+     */
+    bool needs_resolution(const RawPayload<T>& payload) const noexcept
+    {
+        if (!std::holds_alternative<T>(payload)) {
+            return true;
+        }
+        if constexpr (std::is_floating_point_v<T>) {
+            const T value = std::get<T>(payload);
+            const bool replace_nan = !std::holds_alternative<std::monostate>(m_nan);
+            const bool replace_inf = !std::holds_alternative<std::monostate>(m_inf);
+            return (replace_nan && std::isnan(value)) || (replace_inf && std::isinf(value));
+        }
+        return false;
+    }
+
+    /// Whether or not a NaN or infinity result would be replaced by resolve()
+    bool replaces_nan_or_inf() const noexcept
+    {
+        if constexpr (std::is_floating_point_v<T>) {
+            return !std::holds_alternative<std::monostate>(m_nan)
+                || !std::holds_alternative<std::monostate>(m_inf);
+        }
+        return false;
+    }
+
+    /**
+     * \brief Apply the user's replacement actions to a parsed payload
+     * \param payload The result of parse()
+     * \param input The Python object the payload was parsed from
+     * \return The C number in the template type specified, or std::nullopt
+     *         if a Python exception is set
+     */
+    std::optional<T>
+    resolve(const RawPayload<T>& payload, PyObject* input) const noexcept(false)
+    {
         // Function to pass-through a valid value, handling the special
         // case of the value being NaN or INF and requiring a replacement.
-        auto handle_value = [&](const T value) -> T {
+        auto handle_value = [&](const T value) -> std::optional<T> {
             if constexpr (std::is_floating_point_v<T>) {
                 const bool replace_nan = !std::holds_alternative<std::monostate>(m_nan);
                 const bool replace_inf = !std::holds_alternative<std::monostate>(m_inf);
@@ -77,7 +187,7 @@ public:
         };
 
         // Function to call the appropriate error handler if an error occured.
-        auto handle_error = [this, input](const ErrorType err) -> T {
+        auto handle_error = [this, input](const ErrorType err) -> std::optional<T> {
             if (err == ErrorType::BAD_VALUE) {
                 return replace_value(ReplaceType::FAIL_, input);
             } else if (err == ErrorType::OVERFLOW_) {
@@ -141,6 +251,81 @@ public:
         add_replacement_to_mapping(ReplaceType::TYPE_ERROR_, replacement);
     }
 
+    /**
+     * \brief Record calls of the user's callables instead of calling them
+     *
+     * A placeholder value (zero) is returned in place of the result of each
+     * call, which must be replaced after calling DeferredCalls::call().
+     *
+     * \param deferred Where to record the calls, or nullptr to call directly
+     */
+    void set_deferred_calls(DeferredCalls* deferred) noexcept { m_deferred = deferred; }
+
+    /**
+     * \brief Convert the value returned from a user callable into a C number
+     * \param value The value the callable returned
+     * \param input The Python object that was given to the callable
+     * \param option The name of the option the callable was given to
+     * \return The C number in the template type specified, or std::nullopt
+     *         if a Python exception is set
+     */
+    std::optional<T> convert_callable_result(
+        PyObject* value, PyObject* input, const char* option
+    ) const noexcept(false)
+    {
+        // Function to set an exception on conversion error
+        auto handle_call_value_error = [&](const ErrorType err) -> std::optional<T> {
+            if (err == ErrorType::TYPE_ERROR) {
+                PyObject* type_name = PyType_GetName(Py_TYPE(input));
+                PyErr_Format(
+                    PyExc_TypeError,
+                    "Callable passed to '%s' with input %.200R returned the "
+                    "value %.200R that has type %.200R which cannot be "
+                    "converted to a numeric value",
+                    option,
+                    input,
+                    value,
+                    type_name
+                );
+                Py_DECREF(type_name);
+            } else if (err == ErrorType::OVERFLOW_) {
+                PyErr_Format(
+                    PyExc_OverflowError,
+                    "Callable passed to '%s' with input %.200R returned the "
+                    "value %.200R that cannot be converted to C type '%s' "
+                    "without overflowing",
+                    option,
+                    input,
+                    value,
+                    type_name<T>()
+                );
+            } else {
+                PyErr_Format(
+                    PyExc_ValueError,
+                    "Callable passed to '%s' with input %.200R returned the "
+                    "value %.200R that cannot be converted to C type '%s'",
+                    option,
+                    input,
+                    value,
+                    type_name<T>()
+                );
+            }
+            return std::nullopt;
+        };
+
+        // Attempt to extract the C type, but check for errors here too.
+        const NumericParser parser(value, m_options);
+        return std::visit(
+            overloaded {
+                [](const T call_value) -> std::optional<T> {
+                    return call_value;
+                },
+                handle_call_value_error,
+            },
+            parser.as_number<T>()
+        );
+    }
+
 private:
     /// Represent reasons to replace a value
     enum class ReplaceType {
@@ -184,6 +369,9 @@ private:
     /// A buffer into which to store text data
     Buffer m_buffer;
 
+    /// Where to record calls of the user's callables, nullptr to call directly
+    DeferredCalls* m_deferred;
+
 private:
     /// Return the object that corresponds to the user's requested key -
     /// the return is a reference so it can be edited
@@ -225,13 +413,14 @@ private:
      * \brief Replace the given input in the user-specified method
      * \param key The key to use to look up the appropriate replacement method
      * \param input The Python object that triggered the need for a replacement
-     * \return The C number after replacement
-     * \throw exception_is_set If a Python exception is set and needs to be raised
+     * \return The C number after replacement, or std::nullopt if a Python
+     *         exception is set
      */
-    T replace_value(ReplaceType key, PyObject* input) const noexcept(false)
+    std::optional<T> replace_value(ReplaceType key, PyObject* input) const
+        noexcept(false)
     {
-        // Function to raise a Python exception on error
-        auto raise_exception = [input, key](std::monostate) -> T {
+        // Function to set a Python exception on error
+        auto raise_exception = [input, key](std::monostate) -> std::optional<T> {
             if (key == ReplaceType::FAIL_) {
                 PyErr_Format(
                     PyExc_ValueError,
@@ -257,7 +446,7 @@ private:
                 );
                 Py_DECREF(type_name);
             }
-            throw exception_is_set();
+            return std::nullopt;
         };
 
         // A safe and clean way to perform different actions on a std::variant based
@@ -266,10 +455,10 @@ private:
         // in the variant. What each action does is annotated above.
         return std::visit(
             overloaded {
-                [](const T arg) -> T {
+                [](const T arg) -> std::optional<T> {
                     return arg;
                 },
-                [this, input, key](PyObject* arg) -> T {
+                [this, input, key](PyObject* arg) -> std::optional<T> {
                     return call_python_convert_result(arg, input, key);
                 },
                 raise_exception,
@@ -351,77 +540,35 @@ private:
      * \param callable The Python callable object
      * \param input The Python object to be given to the callalbe
      * \param key The key describing which callable is being invoked
-     * \return A C-type of what was returned from the callable
-     * \throws exception_is_set
+     * \return A C-type of what was returned from the callable, or std::nullopt
+     *         if a Python exception is set
      */
-    T call_python_convert_result(
+    std::optional<T> call_python_convert_result(
         PyObject* callable, PyObject* input, const ReplaceType key
     ) const
     {
+        // If requested, only record the call and return a placeholder
+        if (m_deferred != nullptr) {
+            if (!m_deferred->add(callable, m_replace_repr.at(key), input)) {
+                return std::nullopt;
+            }
+            return T {};
+        }
+
         // Call a Python function
         PyObject* retval = PyObject_CallFunctionObjArgs(callable, input, nullptr);
 
         // On exception, no need to define our our own message,
         // I'm sure Python's is just fine.
         if (retval == nullptr) {
-            throw exception_is_set();
+            return std::nullopt;
         }
 
-        // Function to raise an exception on conversion error, then decrease
-        // the reference count of the Python object returned from the callable.
-        auto handle_call_value_error = [&](const ErrorType err) -> T {
-            if (err == ErrorType::TYPE_ERROR) {
-                PyObject* type_name = PyType_GetName(Py_TYPE(input));
-                PyErr_Format(
-                    PyExc_TypeError,
-                    "Callable passed to '%s' with input %.200R returned the "
-                    "value %.200R that has type %.200R which cannot be "
-                    "converted to a numeric value",
-                    m_replace_repr.at(key),
-                    input,
-                    retval,
-                    type_name
-                );
-                Py_DECREF(type_name);
-            } else if (err == ErrorType::OVERFLOW_) {
-                PyErr_Format(
-                    PyExc_OverflowError,
-                    "Callable passed to '%s' with input %.200R returned the "
-                    "value %.200R that cannot be converted to C type '%s' "
-                    "without overflowing",
-                    m_replace_repr.at(key),
-                    input,
-                    retval,
-                    type_name<T>()
-                );
-            } else {
-                PyErr_Format(
-                    PyExc_ValueError,
-                    "Callable passed to '%s' with input %.200R returned the "
-                    "value %.200R that cannot be converted to C type '%s'",
-                    m_replace_repr.at(key),
-                    input,
-                    retval,
-                    type_name<T>()
-                );
-            }
-            Py_DECREF(retval);
-            throw exception_is_set();
-        };
-
-        // If there was no error calling the function, attempt to extract the
-        // C type, but check for errors here too. Make sure we decrease the
-        // reference count of what was returned by the the callable.
-        const NumericParser parser(retval, m_options);
-        return std::visit(
-            overloaded {
-                [retval](const T call_value) -> T {
-                    Py_DECREF(retval);
-                    return call_value;
-                },
-                handle_call_value_error,
-            },
-            parser.as_number<T>()
-        );
+        // Make sure we decrease the reference count of what was returned
+        // by the the callable.
+        const std::optional<T> value
+            = convert_callable_result(retval, input, m_replace_repr.at(key));
+        Py_DECREF(retval);
+        return value;
     }
 };
@@ -0,0 +1,176 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+#include <Python.h>
+
+/**
+ * \class DeferredCalls
+ * \brief Collect the inputs given to user callables so each is only called once
+ *
+ * Instead of calling a replacement callable (e.g. on_fail) for each
+ * element of an iterable, the element and its position in the output
+ * are recorded. Once all elements have been converted, each callable
+ * is called a single time with a list of all of its inputs and must
+ * return an iterable of the same length, whose values are then placed
+ * into the output. This lets vectorised fallback parsers keep their speed.
+ */
+class DeferredCalls {
+public:
+    /// Construct with no calls recorded
+    DeferredCalls() noexcept
+        : m_calls()
+    { }
+
+    // Copy and assignment are disallowed
+    DeferredCalls(const DeferredCalls&) = delete;
+    DeferredCalls(DeferredCalls&&) = delete;
+    DeferredCalls& operator=(const DeferredCalls&) = delete;
+
+    /// Destruct, releasing the recorded inputs
+    ~DeferredCalls() noexcept
+    {
+        for (const Call& call : m_calls) {
+            Py_DECREF(call.input);
+        }
+    }
+
+    /**
+     * \brief Record that a callable must be called with an input
+     * \param callable The callable, which must outlive this object
+     * \param option The name of the option the callable was given to
+     * \param input The input to give to the callable
+     * \return false if a Python exception is set
+     */
+    bool add(PyObject* callable, const char* option, PyObject* input) noexcept
+    {
+        try {
+            m_calls.push_back({ callable, option, input, UNLOCATED });
+        } catch (const std::bad_alloc&) {
+            PyErr_NoMemory();
+            return false;
+        }
+        Py_INCREF(input);
+        return true;
+    }
+
+    /**
+     * \brief Record the output position of the most recently added call
+     *
+     * This should be called for each element after it is converted - it
+     * does nothing if that element did not add a call.
+     *
+     * \param position The position in the output of the element just converted
+     */
+    void locate(const Py_ssize_t position) noexcept
+    {
+        if (!m_calls.empty() && m_calls.back().position == UNLOCATED) {
+            m_calls.back().position = position;
+        }
+    }
+
+    /**
+     * \brief Call each callable once with a list of all of its recorded inputs
+     *
+     * \param place Function accepting the output position, the input, the
+     *              option name, and the (borrowed) value the callable returned
+     *              for that input, that returns false if a Python exception is set
+     * \return false if a Python exception is set
+     */
+    template <typename Function>
+    bool call(Function place) noexcept(false)
+    {
+        // The same callable given to different options is called once per
+        // option so that error messages can name the option.
+        std::vector<bool> done(m_calls.size(), false);
+        for (std::size_t first = 0; first < m_calls.size(); ++first) {
+            if (done[first]) {
+                continue;
+            }
+            std::vector<std::size_t> members;
+            for (std::size_t i = first; i < m_calls.size(); ++i) {
+                if (!done[i] && m_calls[i].callable == m_calls[first].callable
+                    && m_calls[i].option == m_calls[first].option) {
+                    members.push_back(i);
+                    done[i] = true;
+                }
+            }
+            if (!call_one(members, place)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    /// Marker for a call whose output position is not yet known
+    static constexpr Py_ssize_t UNLOCATED = -1;
+
+    /// A single deferred call of a callable
+    struct Call {
+        PyObject* callable;
+        const char* option;
+        PyObject* input;
+        Py_ssize_t position;
+    };
+
+    /// All calls in the order they were recorded
+    std::vector<Call> m_calls;
+
+private:
+    /// Call one callable with the inputs of the given calls and place the results
+    template <typename Function>
+    bool call_one(const std::vector<std::size_t>& members, Function& place)
+        noexcept(false)
+    {
+        const Call& first = m_calls[members.front()];
+        const Py_ssize_t ninputs = static_cast<Py_ssize_t>(members.size());
+
+        PyObject* inputs = PyList_New(ninputs);
+        if (inputs == nullptr) {
+            return false;
+        }
+        for (Py_ssize_t i = 0; i < ninputs; ++i) {
+            PyObject* input = m_calls[members[i]].input;
+            Py_INCREF(input);
+            PyList_SET_ITEM(inputs, i, input);
+        }
+        PyObject* retval = PyObject_CallFunctionObjArgs(first.callable, inputs, nullptr);
+        Py_DECREF(inputs);
+        if (retval == nullptr) {
+            return false;
+        }
+
+        PyObject* results = PySequence_Fast(
+            retval, "Callable passed to a batch option must return an iterable"
+        );
+        Py_DECREF(retval);
+        if (results == nullptr) {
+            return false;
+        }
+        if (PySequence_Fast_GET_SIZE(results) != ninputs) {
+            PyErr_Format(
+                PyExc_ValueError,
+                "Callable passed to '%s' returned %zd values for %zd inputs",
+                first.option,
+                PySequence_Fast_GET_SIZE(results),
+                ninputs
+            );
+            Py_DECREF(results);
+            return false;
+        }
+
+        PyObject** values = PySequence_Fast_ITEMS(results);
+        for (Py_ssize_t i = 0; i < ninputs; ++i) {
+            const Call& call = m_calls[members[i]];
+            if (!place(call.position, call.input, call.option, values[i])) {
+                Py_DECREF(results);
+                return false;
+            }
+        }
+        Py_DECREF(results);
+        return true;
+    }
+};
@@ -8,7 +8,8 @@ PyDoc_STRVAR(
     try_real__doc__,
     "try_real(x, *, inf=fastnumbers.ALLOWED, nan=fastnumbers.ALLOWED, "
     "on_fail=fastnumbers.INPUT, on_type_error=fastnumbers.RAISE, "
-    "coerce=True, allow_underscores=False, map=False)\n"
+    "coerce=True, allow_underscores=False, map=False, cache=False, "
+    "batch_callables=False)\n"
     "Quickly convert input to an *int* or *float* depending on value.\n"
     "\n"
     "Any input that is valid for the built-in *float* or *int* functions will\n"
@@ -59,6 +60,19 @@ PyDoc_STRVAR(
     "    function accepts an iterable of values to convert. If *True* it returns\n"
     "    an iterable of the results, and if *list* it returns a *list* of\n"
     "    the results. The default is *False*.\n"
+    "cache : bool, optional\n"
+    "    If *True* and *map* is not *False*, the result of converting each *str*\n"
+    "    is remembered so that repeated strings are not parsed again, which is\n"
+    "    faster for data with few distinct values. If *map* is *list* repeated\n"
+    "    strings also share the same result object. The cache turns itself off\n"
+    "    if few strings are repeated. The default is *False*.\n"
+    "batch_callables : bool, optional\n"
+    "    If *True* and *map* is *list*, each callable given to `inf`, `nan`,\n"
+    "    `on_fail` or `on_type_error` is called only once, after all other\n"
+    "    elements are converted, with a *list* of all the inputs it applies to.\n"
+    "    It must return an iterable of the same length containing the values to\n"
+    "    use for those inputs. This is useful for fallback parsers that are\n"
+    "    vectorised. The default is *False*.\n"
     "\n"
     "Returns\n"
     "-------\n"
@@ -129,7 +143,8 @@ PyDoc_STRVAR(
     try_float__doc__,
     "try_float(x, *, inf=fastnumbers.ALLOWED, nan=fastnumbers.ALLOWED, "
     "on_fail=fastnumbers.INPUT, on_type_error=fastnumbers.RAISE, "
-    "allow_underscores=False, map=False)\n"
+    "allow_underscores=False, map=False, cache=False, "
+    "batch_callables=False)\n"
     "Quickly convert input to a *float*.\n"
     "\n"
     "Any input that is valid for the built-in *float* function will\n"
@@ -176,6 +191,16 @@ PyDoc_STRVAR(
     "    function accepts an iterable of values to convert. If *True* it returns\n"
     "    an iterable of the results, and if *list* it returns a *list* of\n"
     "    the results. The default is *False*.\n"
+    "cache : bool, optional\n"
+    "    If *True* and *map* is not *False*, repeated strings are not parsed\n"
+    "    again. See :func:`try_real` for details. The default is *False*.\n"
+    "batch_callables : bool, optional\n"
+    "    If *True* and *map* is *list*, each callable given to `inf`, `nan`,\n"
+    "    `on_fail` or `on_type_error` is called only once, after all other\n"
+    "    elements are converted, with a *list* of all the inputs it applies to.\n"
+    "    It must return an iterable of the same length containing the values to\n"
+    "    use for those inputs. This is useful for fallback parsers that are\n"
+    "    vectorised. The default is *False*.\n"
     "\n"
     "Returns\n"
     "-------\n"
@@ -238,7 +263,8 @@ PyDoc_STRVAR(
 PyDoc_STRVAR(
     try_int__doc__,
     "try_int(x, *, on_fail=fastnumbers.INPUT, on_type_error=fastnumbers.RAISE, "
-    "base=10, allow_underscores=False, map=False)\n"
+    "base=10, allow_underscores=False, map=False, cache=False, "
+    "batch_callables=False)\n"
     "Quickly convert input to an *int*.\n"
     "\n"
     "Any input that is valid for the built-in *int*\n"
@@ -278,6 +304,16 @@ PyDoc_STRVAR(
     "    function accepts an iterable of values to convert. If *True* it returns\n"
     "    an iterable of the results, and if *list* it returns a *list* of\n"
     "    the results. The default is *False*.\n"
+    "cache : bool, optional\n"
+    "    If *True* and *map* is not *False*, repeated strings are not parsed\n"
+    "    again. See :func:`try_real` for details. The default is *False*.\n"
+    "batch_callables : bool, optional\n"
+    "    If *True* and *map* is *list*, each callable given to `on_fail` or\n"
+    "    `on_type_error` is called only once, after all other elements are\n"
+    "    converted, with a *list* of all the inputs it applies to.\n"
+    "    It must return an iterable of the same length containing the values to\n"
+    "    use for those inputs. This is useful for fallback parsers that are\n"
+    "    vectorised. The default is *False*.\n"
     "\n"
     "Returns\n"
     "-------\n"
@@ -341,7 +377,8 @@ PyDoc_STRVAR(
 PyDoc_STRVAR(
     try_forceint__doc__,
     "try_forceint(x, *, on_fail=fastnumbers.INPUT, on_type_error=fastnumbers.RAISE, "
-    "allow_underscores=False, map=False)\n"
+    "allow_underscores=False, map=False, cache=False, "
+    "batch_callables=False)\n"
     "Quickly convert input to an *int*, truncating if a *float*.\n"
     "\n"
     "Any input that is valid for the built-in *int*\n"
@@ -381,6 +418,16 @@ PyDoc_STRVAR(
     "    function accepts an iterable of values to convert. If *True* it returns\n"
     "    an iterable of the results, and if *list* it returns a *list* of\n"
     "    the results. The default is *False*.\n"
+    "cache : bool, optional\n"
+    "    If *True* and *map* is not *False*, repeated strings are not parsed\n"
+    "    again. See :func:`try_real` for details. The default is *False*.\n"
+    "batch_callables : bool, optional\n"
+    "    If *True* and *map* is *list*, each callable given to `on_fail` or\n"
+    "    `on_type_error` is called only once, after all other elements are\n"
+    "    converted, with a *list* of all the inputs it applies to.\n"
+    "    It must return an iterable of the same length containing the values to\n"
+    "    use for those inputs. This is useful for fallback parsers that are\n"
+    "    vectorised. The default is *False*.\n"
     "\n"
     "Returns\n"
     "-------\n"
@@ -435,6 +482,95 @@ PyDoc_STRVAR(
     "\n"
 );
 
+PyDoc_STRVAR(
+    Converter__doc__,
+    "Converter(kind='real', *, inf=fastnumbers.ALLOWED, nan=fastnumbers.ALLOWED, "
+    "on_fail=fastnumbers.INPUT, on_overflow=fastnumbers.RAISE, "
+    "on_type_error=fastnumbers.RAISE, coerce=True, base=10, allow_underscores=False)\n"
+    "A reusable converter with pre-validated options.\n"
+    "\n"
+    "The options are validated once when the *Converter* is created, so calling\n"
+    "it avoids the cost of parsing and validating the options on each call.\n"
+    "This is useful when the same conversion is performed many times.\n"
+    "\n"
+    "Calling the *Converter* with a single value behaves exactly like calling\n"
+    "the matching ``try_*`` function with the same options.\n"
+    "\n"
+    "Parameters\n"
+    "----------\n"
+    "kind : {'real', 'float', 'int', 'forceint'}, optional\n"
+    "    The ``try_*`` function whose behavior this converter will have.\n"
+    "    The default is 'real'.\n"
+    "inf : optional\n"
+    "    See :func:`try_real`. Ignored if `kind` is 'int' or 'forceint'.\n"
+    "nan : optional\n"
+    "    See :func:`try_real`. Ignored if `kind` is 'int' or 'forceint'.\n"
+    "on_fail : optional\n"
+    "    See :func:`try_real`. For :meth:`array`, *INPUT* behaves as *RAISE*.\n"
+    "on_overflow : optional\n"
+    "    See :func:`try_array`. Only used by :meth:`array`.\n"
+    "on_type_error : optional\n"
+    "    See :func:`try_real`.\n"
+    "coerce : bool, optional\n"
+    "    See :func:`try_real`. Only used if `kind` is 'real'.\n"
+    "base : int, optional\n"
+    "    See :func:`try_int`. Only used if `kind` is 'int', or by :meth:`array`.\n"
+    "allow_underscores : bool, optional\n"
+    "    See :func:`try_real`.\n"
+    "\n"
+    "Raises\n"
+    "------\n"
+    "ValueError\n"
+    "    If `kind` or any of the options are invalid.\n"
+    "\n"
+    "See Also\n"
+    "--------\n"
+    "try_real\n"
+    "try_float\n"
+    "try_int\n"
+    "try_forceint\n"
+    "try_array\n"
+    "\n"
+    "Examples\n"
+    "--------\n"
+    "\n"
+    "    >>> from fastnumbers import Converter\n"
+    "    >>> to_float = Converter('float', on_fail=0.0)\n"
+    "    >>> to_float('56.07')\n"
+    "    56.07\n"
+    "    >>> to_float('invalid')\n"
+    "    0.0\n"
+    "    >>> to_float.list(['5', '3.5', 'invalid'])\n"
+    "    [5.0, 3.5, 0.0]\n"
+    "\n"
+);
+
+PyDoc_STRVAR(
+    Converter_map__doc__,
+    "map(input)\n"
+    "Convert each element of an iterable, returning an iterator of the results.\n"
+    "\n"
+    "Equivalent to calling the matching ``try_*`` function with ``map=True``.\n"
+);
+
+PyDoc_STRVAR(
+    Converter_list__doc__,
+    "list(input)\n"
+    "Convert each element of an iterable, returning a *list* of the results.\n"
+    "\n"
+    "Equivalent to calling the matching ``try_*`` function with ``map=list``.\n"
+);
+
+PyDoc_STRVAR(
+    Converter_array__doc__,
+    "array(input, output)\n"
+    "Convert each element of an iterable into an existing array.\n"
+    "\n"
+    "Equivalent to calling :func:`try_array` with `output` given. The\n"
+    "`output` must be a one-dimensional ``numpy.ndarray`` or ``array.array``\n"
+    "of integral or float type with the same length as the input.\n"
+);
+
 PyDoc_STRVAR(
     check_real__doc__,
     "check_real(x, *, consider=None, inf=fastnumbers.NUMBER_ONLY, "
@@ -803,6 +939,264 @@ PyDoc_STRVAR(
     "\n"
 );
 
+PyDoc_STRVAR(
+    natsort_key__doc__,
+    "natsort_key(x, *, signed=False, float=False, exp=True, casefold=False)\n"
+    "Create a key that sorts strings in natural order, e.g. 'a2' before 'a10'.\n"
+    "\n"
+    "The string is scanned once and split into a *tuple* of alternating text\n"
+    "and numbers, so that the numbers within strings are compared by value.\n"
+    "The key always starts with text, which is the empty string if the string\n"
+    "starts with a number, and adjacent numbers are separated by empty text,\n"
+    "so that keys are always comparable. An *int* or *float* is sorted as a\n"
+    "string containing only that number.\n"
+    "\n"
+    "Parameters\n"
+    "----------\n"
+    "x : str, int or float\n"
+    "    The input to create the key of.\n"
+    "signed : bool, optional\n"
+    "    If *True*, a '+' or '-' immediately before a number is part of it, so\n"
+    "    e.g. 'a-5' sorts before 'a-3'. The default is *False*.\n"
+    "float : bool, optional\n"
+    "    If *True*, numbers may have a decimal point and are converted to *float*.\n"
+    "    Otherwise, numbers are runs of digits converted to *int*. The default\n"
+    "    is *False*.\n"
+    "exp : bool, optional\n"
+    "    If *True* and ``float`` is *True*, numbers may have an exponent (e.g.\n"
+    "    '1e5'). The default is *True*.\n"
+    "casefold : bool, optional\n"
+    "    If *True*, text is casefolded so that the order is case-insensitive.\n"
+    "    The default is *False*.\n"
+    "\n"
+    "Returns\n"
+    "-------\n"
+    "key : tuple\n"
+    "    The key of the input.\n"
+    "\n"
+    "Raises\n"
+    "------\n"
+    "TypeError\n"
+    "    If the input is not a *str*, *int* or *float*.\n"
+    "\n"
+    "See Also\n"
+    "--------\n"
+    "natsort_keys\n"
+    "\n"
+    "Examples\n"
+    "--------\n"
+    "\n"
+    "    >>> from fastnumbers import natsort_key\n"
+    "    >>> natsort_key('version-1.10.2')\n"
+    "    ('version-', 1, '.', 10, '.', 2)\n"
+    "    >>> natsort_key('12 apples')\n"
+    "    ('', 12, ' apples')\n"
+    "    >>> natsort_key('x-1.5e3', signed=True, float=True)\n"
+    "    ('x', -1500.0)\n"
+    "    >>> sorted(['a10', 'A2', 'a1'], key=lambda x: natsort_key(x, casefold=True))\n"
+    "    ['a1', 'A2', 'a10']\n"
+    "\n"
+);
+
+PyDoc_STRVAR(
+    natsort_keys__doc__,
+    "natsort_keys(input, *, signed=False, float=False, exp=True, casefold=False)\n"
+    "Create the natural sort key of each element of an iterable.\n"
+    "\n"
+    "This gives the same keys as calling :func:`natsort_key` on each element,\n"
+    "but without the overhead of a call for each element.\n"
+    "\n"
+    "Parameters\n"
+    "----------\n"
+    "input : iterable of str, int or float\n"
+    "    The inputs to create the keys of.\n"
+    "signed, float, exp, casefold : bool, optional\n"
+    "    Control how keys are created. See :func:`natsort_key`.\n"
+    "\n"
+    "Returns\n"
+    "-------\n"
+    "keys : list of tuple\n"
+    "    The key of each input.\n"
+    "\n"
+    "Raises\n"
+    "------\n"
+    "TypeError\n"
+    "    If an input is not a *str*, *int* or *float*.\n"
+    "\n"
+    "See Also\n"
+    "--------\n"
+    "natsort_key\n"
+    "\n"
+    "Examples\n"
+    "--------\n"
+    "\n"
+    "    >>> from fastnumbers import natsort_keys\n"
+    "    >>> names = ['file10.txt', 'file9.txt', 'file1.txt']\n"
+    "    >>> keys = natsort_keys(names)\n"
+    "    >>> [name for _, name in sorted(zip(keys, names))]\n"
+    "    ['file1.txt', 'file9.txt', 'file10.txt']\n"
+    "\n"
+);
+
+PyDoc_STRVAR(
+    natcmp__doc__,
+    "natcmp(a, b, *, signed=False, float=False, exp=True, casefold=False)\n"
+    "Compare two objects in natural order.\n"
+    "\n"
+    "This gives the same result as comparing the keys of :func:`natsort_key`,\n"
+    "but two *str* are compared chunk by chunk in place, without creating\n"
+    "keys or number objects.\n"
+    "\n"
+    "Parameters\n"
+    "----------\n"
+    "a, b : str, int or float\n"
+    "    The objects to compare.\n"
+    "signed, float, exp, casefold : bool, optional\n"
+    "    Control how numbers are found and text is compared. See\n"
+    "    :func:`natsort_key`.\n"
+    "\n"
+    "Returns\n"
+    "-------\n"
+    "result : int\n"
+    "    -1 if *a* sorts before *b*, 1 if *a* sorts after *b*, and 0 otherwise.\n"
+    "\n"
+    "Raises\n"
+    "------\n"
+    "TypeError\n"
+    "    If an input is not a *str*, *int* or *float*.\n"
+    "\n"
+    "See Also\n"
+    "--------\n"
+    "natsort_key, natsorted\n"
+    "\n"
+    "Examples\n"
+    "--------\n"
+    "\n"
+    "    >>> from fastnumbers import natcmp\n"
+    "    >>> natcmp('a2', 'a10')\n"
+    "    -1\n"
+    "    >>> natcmp('a010', 'a10')\n"
+    "    0\n"
+    "    >>> natcmp('x-1', 'x-2', signed=True)\n"
+    "    1\n"
+    "\n"
+);
+
+PyDoc_STRVAR(
+    natsorted__doc__,
+    "natsorted(input, *, key=None, reverse=False, signed=False, float=False, "
+    "exp=True, casefold=False)\n"
+    "Sort the objects of an iterable in natural order into a new list.\n"
+    "\n"
+    "This gives the same result as ``sorted(input, key=natsort_key)``, but\n"
+    "when all the objects are *str* they are compared in place, without\n"
+    "creating keys or number objects and without holding the GIL. Like\n"
+    ":func:`sorted`, the sort is stable.\n"
+    "\n"
+    "Parameters\n"
+    "----------\n"
+    "input : iterable of str, int or float\n"
+    "    The objects to sort.\n"
+    "key : callable, optional\n"
+    "    A function returning the *str*, *int* or *float* to sort each object\n"
+    "    by. The default is to sort by the objects themselves.\n"
+    "reverse : bool, optional\n"
+    "    If *True*, sort from last to first. The default is *False*.\n"
+    "signed, float, exp, casefold : bool, optional\n"
+    "    Control how numbers are found and text is compared. See\n"
+    "    :func:`natsort_key`.\n"
+    "\n"
+    "Returns\n"
+    "-------\n"
+    "sorted : list\n"
+    "    The objects in natural order.\n"
+    "\n"
+    "Raises\n"
+    "------\n"
+    "TypeError\n"
+    "    If an object to sort by is not a *str*, *int* or *float*.\n"
+    "\n"
+    "See Also\n"
+    "--------\n"
+    "natsort_key, natcmp\n"
+    "\n"
+    "Examples\n"
+    "--------\n"
+    "\n"
+    "    >>> from fastnumbers import natsorted\n"
+    "    >>> natsorted(['file10.txt', 'file9.txt', 'file1.txt'])\n"
+    "    ['file1.txt', 'file9.txt', 'file10.txt']\n"
+    "    >>> natsorted(['B2', 'a10', 'a2'], casefold=True, reverse=True)\n"
+    "    ['B2', 'a10', 'a2']\n"
+    "    >>> natsorted([('x', 'v1.10'), ('y', 'v1.9')], key=lambda p: p[1])\n"
+    "    [('y', 'v1.9'), ('x', 'v1.10')]\n"
+    "\n"
+);
+
+PyDoc_STRVAR(
+    find_numbers__doc__,
+    "find_numbers(text, kind='real', *, signed=True, exp=True, offsets=False, "
+    "map=False)\n"
+    "Find every number within text, such as a log line or a measurement.\n"
+    "\n"
+    "The text is scanned once from left to right, and each number found is\n"
+    "converted as it is found, without regular expressions. A number is a run\n"
+    "of decimal digits (including those of other scripts), optionally with a\n"
+    "sign and, for *real* and *float*, a decimal point (with digits on at\n"
+    "least one side) and an exponent. A number ends where it cannot be\n"
+    "continued, e.g. ``'1.2.3'`` contains ``1.2`` then ``0.3``.\n"
+    "\n"
+    "Parameters\n"
+    "----------\n"
+    "text : str\n"
+    "    The text to search.\n"
+    "kind : str, optional\n"
+    "    The kind of numbers to find. If *'real'*, numbers with a decimal point\n"
+    "    or exponent are returned as *float* and all others as *int*. If\n"
+    "    *'float'*, all numbers are returned as *float*. If *'int'*, numbers\n"
+    "    are runs of digits and are returned as *int*. The default is *'real'*.\n"
+    "signed : bool, optional\n"
+    "    If *True*, a '+' or '-' immediately before a number is part of it.\n"
+    "    The default is *True*.\n"
+    "exp : bool, optional\n"
+    "    If *True* and ``kind`` is not *'int'*, numbers may have an exponent\n"
+    "    (e.g. '1e5'). The default is *True*.\n"
+    "offsets : bool, optional\n"
+    "    If *True*, each number is returned in a *tuple* with the start and end\n"
+    "    offsets (in characters) of its text. The default is *False*.\n"
+    "map : bool or type(list), optional\n"
+    "    If *True* or *list*, instead of accepting a single text to search this\n"
+    "    function accepts an iterable of texts to search. If *True* it returns\n"
+    "    an iterable of the results, and if *list* it returns a *list* of\n"
+    "    the results. The default is *False*.\n"
+    "\n"
+    "Returns\n"
+    "-------\n"
+    "numbers : list\n"
+    "    The numbers found, in order, or tuples of each number and its offsets.\n"
+    "\n"
+    "Raises\n"
+    "------\n"
+    "TypeError\n"
+    "    If the text is not a *str*.\n"
+    "ValueError\n"
+    "    If ``kind`` is not valid.\n"
+    "\n"
+    "Examples\n"
+    "--------\n"
+    "\n"
+    "    >>> from fastnumbers import find_numbers\n"
+    "    >>> find_numbers('took 12.5ms for 3 rows at -4.1e3 rows/s')\n"
+    "    [12.5, 3, -4100.0]\n"
+    "    >>> find_numbers('size: 1.5x2', kind='int')\n"
+    "    [1, 5, 2]\n"
+    "    >>> find_numbers('x=1, y=-2', offsets=True)\n"
+    "    [(1, 2, 3), (-2, 7, 9)]\n"
+    "    >>> find_numbers(['a1', 'b2c3'], map=list)\n"
+    "    [[1], [2, 3]]\n"
+    "\n"
+);
+
 PyDoc_STRVAR(
     fastnumbers_int__doc__,
     "int(x=0, *, base=10)\n"
@@ -11,12 +11,15 @@
 /**
  * \class Evaluator
  * \brief Evaluate the contents of a Python object
+ *
+ * The options may be a FixedOptions so that the checks of options
+ * known at compile time are removed from the evaluation.
  */
-template <typename ParserT>
+template <typename ParserT, typename OptionsT = UserOptions>
 class Evaluator {
 public:
     /// Constructor from a Python object
-    Evaluator(PyObject* obj, const UserOptions& options, const ParserT& parser) noexcept
+    Evaluator(PyObject* obj, const OptionsT& options, const ParserT& parser) noexcept
         : m_obj(obj)
         , m_parser(parser)
         , m_options(options)
@@ -39,7 +42,7 @@ public:
     }
 
     /// Access the user-given options for evaluating
-    const UserOptions& options() const noexcept { return m_options; }
+    const OptionsT& options() const noexcept { return m_options; }
 
     /// Return the parser type currenly associated with the Evaluator
     ParserType parser_type() const noexcept { return m_parser.parser_type(); }
@@ -80,7 +83,7 @@ private:
     const ParserT& m_parser;
 
     /// Hold the evaluator options
-    const UserOptions m_options;
+    const OptionsT m_options;
 
 private:
     /// Logic for evaluating a numeric python object
@@ -188,7 +191,7 @@ private:
         // We use python to convert non-base-10 integer strings.
         // Some strings are not allowed to use an explict base,
         // so check that first.
-        if (m_parser.options().get_base() != 10) {
+        if (options().get_base() != 10) {
             if (m_parser.illegal_explicit_base()) {
                 return ActionType::ERROR_ILLEGAL_EXPLICIT_BASE;
             }
@@ -1,6 +1,5 @@
 #pragma once
 
-#include <functional>
 #include <stdexcept>
 
 /// Custom exception class to tell the handler to just return NULL
@@ -49,7 +48,9 @@ public:
 
     /// Handle all exceptions from running fastnumbers logic.
     /// This is a "function try block", hence the missing pair of braces.
-    PyObject* run(std::function<PyObject*()> func) noexcept(false)
+    /// The function is a template parameter so that it can be inlined.
+    template <typename Function>
+    PyObject* run(Function func) noexcept(false)
     try {
         return func();
     } catch (const exception_is_set&) {
@@ -22,3 +22,20 @@ using AnyParser = std::variant<CharacterParser, UnicodeParser, NumericParser>;
 AnyParser
 extract_parser(PyObject* obj, Buffer& buffer, const UserOptions& options) noexcept(false
 );
+
+/**
+ * \brief Return the appropriate parser for UCS4 text data
+ *
+ * The data need not be nul-terminated, which makes this suitable for
+ * records of a fixed-width unicode array.
+ *
+ * \param data The UCS4 code points from which to extract data
+ * \param len The number of code points in data
+ * \param buffer The buffer into which to potentially store data
+ * \param options A UserOptions instance containing the options
+ *                specified by the user.
+ * \return std::variant of CharacterParser or UnicodeParser
+ */
+AnyParser extract_parser(
+    const Py_UCS4* data, const std::size_t len, Buffer& buffer, const UserOptions& options
+) noexcept(false);
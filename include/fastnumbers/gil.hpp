@@ -0,0 +1,57 @@
+#pragma once
+
+#include <Python.h>
+
+/**
+ * \class GILReleaser
+ * \brief Release the GIL for the lifetime of the object
+ *
+ * The GIL can be temporarily re-acquired (e.g. to call a Python function
+ * or to set a Python exception) and then released again. The GIL is always
+ * held again after the object is destroyed, including during stack unwinding.
+ */
+class GILReleaser {
+public:
+    /**
+     * \brief Release the GIL
+     * \param enabled If false, the GIL will never be released
+     */
+    explicit GILReleaser(const bool enabled = true) noexcept
+        : m_enabled(enabled)
+        , m_state(nullptr)
+    {
+        release();
+    }
+
+    // Cannot copy
+    GILReleaser(const GILReleaser&) = delete;
+    GILReleaser(GILReleaser&&) = delete;
+    GILReleaser& operator=(const GILReleaser&) = delete;
+
+    /// Ensure the GIL is held on destruction
+    ~GILReleaser() noexcept { acquire(); }
+
+    /// Re-acquire the GIL - does nothing if the GIL is already held
+    void acquire() noexcept
+    {
+        if (m_state != nullptr) {
+            PyEval_RestoreThread(m_state);
+            m_state = nullptr;
+        }
+    }
+
+    /// Release the GIL - does nothing if already released or if not enabled
+    void release() noexcept
+    {
+        if (m_enabled && m_state == nullptr) {
+            m_state = PyEval_SaveThread();
+        }
+    }
+
+private:
+    /// Whether or not the GIL is allowed to be released
+    bool m_enabled;
+
+    /// The saved thread state while the GIL is released
+    PyThreadState* m_state;
+};
@@ -1,14 +1,27 @@
 #pragma once
 
+#include <cmath>
 #include <functional>
 #include <limits>
+#include <memory>
 #include <utility>
+#include <variant>
+#include <vector>
 
 #include <Python.h>
 
+#include "fastnumbers/buffer.hpp"
+#include "fastnumbers/cache.hpp"
+#include "fastnumbers/columns.hpp"
+#include "fastnumbers/deferred.hpp"
 #include "fastnumbers/evaluator.hpp"
+#include "fastnumbers/extractor.hpp"
+#include "fastnumbers/iteration.hpp"
+#include "fastnumbers/natural.hpp"
+#include "fastnumbers/parser/base.hpp"
 #include "fastnumbers/resolver.hpp"
 #include "fastnumbers/selectors.hpp"
+#include "fastnumbers/tokenizer.hpp"
 #include "fastnumbers/user_options.hpp"
 
 /**
@@ -68,9 +81,86 @@ public:
     /// Destruct
     ~Implementation() noexcept { Py_XDECREF(m_allowed_types); }
 
+    /// Visit the Python objects held for garbage collection
+    int traverse(visitproc visit, void* arg) const noexcept
+    {
+        if (const int result = m_resolver.traverse(visit, arg)) {
+            return result;
+        }
+        return Selectors::traverse(m_allowed_types, visit, arg);
+    }
+
+    /// Release the Python objects held, restoring the default actions
+    void clear() noexcept
+    {
+        m_resolver.clear();
+        Selectors::reset(m_allowed_types, nullptr);
+    }
+
     /// Convert the object to the desired user type
     PyObject* convert(PyObject* input) const noexcept(false);
 
+    /**
+     * \brief Convert the object to the desired user type with the given options
+     *
+     * The options must be the stored options, but some of the values may
+     * be fixed at compile time - see with_fixed_options().
+     */
+    template <typename OptionsT>
+    PyObject* convert(PyObject* input, const OptionsT& options) const noexcept(false)
+    {
+        if (is_passthrough(input)) {
+            Py_INCREF(input);
+            return input;
+        }
+        return m_resolver.resolve(input, collect_payload(input, options));
+    }
+
+    /**
+     * \brief Convert the object to the desired user type, re-using earlier results
+     *
+     * Results are looked up in and stored into the cache, so a repeated
+     * string is not parsed again. The user's actions (e.g. on_fail) are
+     * still applied to every input.
+     */
+    template <typename OptionsT>
+    PyObject*
+    convert(PyObject* input, const OptionsT& options, InputCache<Payload>& cache) const
+        noexcept(false)
+    {
+        if (const Payload* cached = cache.find(input)) {
+            // The cache keeps its own reference, but resolve() gives one away
+            if (PyObject* const* obj = std::get_if<PyObject*>(cached)) {
+                Py_INCREF(*obj);
+            }
+            return m_resolver.resolve(input, *cached);
+        }
+        if (is_passthrough(input)) {
+            Py_INCREF(input);
+            return input;
+        }
+        const Payload payload = collect_payload(input, options);
+        cache.insert(input, payload);
+        return m_resolver.resolve(input, payload);
+    }
+
+    /**
+     * \brief Call a function with the stored options, fixed at compile time if possible
+     *
+     * This is intended to be done once before converting many objects.
+     */
+    template <typename Function>
+    decltype(auto) with_fixed_options(Function func) const
+    {
+        return ::with_fixed_options(m_options, std::move(func));
+    }
+
+    /// Whether or not converting may call any of the user's callables
+    bool has_callable_actions() const noexcept
+    {
+        return m_resolver.has_callable_actions();
+    }
+
     /// Check if the object is the desired user type
     PyObject* check(PyObject* input) const noexcept(false);
 
@@ -105,6 +195,12 @@ public:
         m_resolver.set_type_error_action(val);
     }
 
+    /// Record calls of the user's callables instead of calling them
+    void set_deferred_calls(DeferredCalls* deferred) noexcept
+    {
+        m_resolver.set_deferred_calls(deferred);
+    }
+
     /// Set whether or not underscores are allowed in strings
     void set_underscores_allowed(const bool val) noexcept
     {
@@ -180,11 +276,55 @@ private:
     };
 
 private:
+    /**
+     * \brief Determine if convert() would return the input unchanged
+     *
+     * Exact float and int objects that need no special handling do not
+     * need to go through parsing, evaluation and resolution, which is
+     * common when re-converting data that has already been converted.
+     *
+     * \param obj The object to be converted
+     */
+    bool is_passthrough(PyObject* obj) const noexcept
+    {
+        if (PyFloat_CheckExact(obj)) {
+            // NaN and INF may need replacing, and intlike floats may need coercion
+            const double value = PyFloat_AS_DOUBLE(obj);
+            if (m_ntype == UserType::FLOAT) {
+                return std::isfinite(value);
+            } else if (m_ntype == UserType::REAL) {
+                return std::isfinite(value)
+                    && !(m_options.allow_coerce() && Parser::float_is_intlike(value));
+            }
+        } else if (PyLong_CheckExact(obj)) {
+            // Ints given with an explicit base are an error
+            return m_ntype == UserType::REAL || m_ntype == UserType::FORCEINT
+                || (m_ntype == UserType::INT && m_options.is_default_base());
+        }
+        return false;
+    }
+
     /// Retrieve the type from the input object
     NumberFlags collect_type(PyObject* obj) const noexcept(false);
 
     /// Convert the object to the desired user type
-    Payload collect_payload(PyObject* obj) const noexcept(false);
+    template <typename OptionsT>
+    Payload collect_payload(PyObject* obj, const OptionsT& options) const noexcept(false)
+    {
+        Buffer buffer;
+
+        // extract_parser() is responsible for taking a python object
+        // and returning the Parser object best suited to parser the object's data.
+        // std:visit is used to obtain the payload data no matter which parser was
+        // returned.
+        return std::visit(
+            [this, obj, &options](const auto& parser) -> Payload {
+                return Evaluator<decltype(parser), OptionsT>(obj, options, parser)
+                    .as_type(m_ntype);
+            },
+            extract_parser(obj, buffer, m_options)
+        );
+    }
 
     /// Figure out as what types we can label the input
     Types resolve_types(const NumberFlags& flags) const noexcept;
@@ -226,21 +366,65 @@ private:
  *
  * \param input The given input object that should be iterable
  * \param convert A function accepting a single argument that performs the conversion
+ * \param deferred If given, the calls of user callables that convert recorded
+ *                 instead of performing, which are performed once at the end
  * \return A new python list containing the converted results, or nullptr on error
  */
+template <typename Function>
 PyObject* list_iteration_impl(
-    PyObject* input, std::function<PyObject*(PyObject*)> convert
-) noexcept(false);
+    PyObject* input, Function convert, DeferredCalls* deferred = nullptr
+) noexcept(false)
+{
+    // Create a python list into which to store the return values
+    ListBuilder list_builder(input);
+
+    // The helper for iterating over the Python iterable
+    IterableManager<PyObject*, Function> iter_manager(input, std::move(convert));
+
+    // For each element in the Python iterable, convert it and append to the list.
+    // On failure a Python exception is set, so NULL can be returned directly.
+    Py_ssize_t position = 0;
+    for (auto& value : iter_manager) {
+        if (!list_builder.append(value)) {
+            return nullptr;
+        }
+        if (deferred != nullptr) {
+            deferred->locate(position++);
+        }
+    }
+
+    // Return the list to the user
+    PyObject* list = list_builder.release();
+    if (deferred == nullptr || list == nullptr) {
+        return list;
+    }
+
+    // Replace the placeholders with what the user callables return
+    auto replace = [list](Py_ssize_t index, PyObject*, const char*, PyObject* value) {
+        Py_INCREF(value);
+        return PyList_SetItem(list, index, value) == 0;
+    };
+    if (!deferred->call(replace)) {
+        Py_DECREF(list);
+        return nullptr;
+    }
+    return list;
+}
 
 /**
  * \brief Iterate over the elements of a collection and convert each one into an iterator
  *
  * \param input The given input object that should be iterable
  * \param convert A function accepting a single argument that performs the conversion
+ * \param read_ahead Whether or not elements may be converted before their
+ *                   results are requested - it must be false if converting
+ *                   may call the user's callables
  * \return A new python iterator producing the converted results, or nullptr on error
  */
 PyObject* iter_iteration_impl(
-    PyObject* input, std::function<PyObject*(PyObject*)> convert
+    PyObject* input,
+    std::function<PyObject*(PyObject*)> convert,
+    const bool read_ahead = true
 ) noexcept(false);
 
 /**
@@ -254,6 +438,8 @@ PyObject* iter_iteration_impl(
  * \param on_overflow The object specifying what action to take on overflow
  * \param on_type_error The object specifying what action to take on type error
  * \param allow_underscores Whether or not it is OK for numbers to contain underscores
+ * \param cache Whether or not to re-use the results of repeated strings
+ * \param batch_callables Whether or not to call each callable once with all its inputs
  * \param base The integer base use when parsing ints, use INT_MIN for default
  */
 void array_impl(
@@ -265,5 +451,179 @@ void array_impl(
     PyObject* on_overflow,
     PyObject* on_type_error,
     bool allow_underscores,
+    bool cache,
+    bool batch_callables,
+    const int base = std::numeric_limits<int>::min()
+) noexcept(false);
+
+/**
+ * \brief Parse each token of some text into an array
+ *
+ * \param tokens The source of the tokens, which is consumed
+ * \param output The object containing the array to populate, which must
+ *               be the same length as the number of tokens
+ * \param inf The object specifying what action to take if INF is found
+ * \param nan The object specifying what action to take if NaN is found
+ * \param on_fail The object specifying what action to take on conversion failure
+ * \param on_overflow The object specifying what action to take on overflow
+ * \param allow_underscores Whether or not it is OK for numbers to contain underscores
+ * \param base The integer base use when parsing ints, use INT_MIN for default
+ */
+void tokens_array_impl(
+    Tokenizer& tokens,
+    PyObject* output,
+    PyObject* inf,
+    PyObject* nan,
+    PyObject* on_fail,
+    PyObject* on_overflow,
+    bool allow_underscores,
+    const int base = std::numeric_limits<int>::min()
+) noexcept(false);
+
+/**
+ * \brief Create the filler of one array of a conversion that fills several arrays
+ *
+ * \param output The object containing the array to populate
+ * \param mask The object containing the validity mask to populate, or None
+ * \param rows The number of rows the array must have
+ * \param replacements The objects specifying what actions to take for
+ *                     INF, NaN, conversion failure, overflow and type error
+ * \param allow_underscores Whether or not it is OK for numbers to contain underscores
+ * \param base The integer base use when parsing ints, use INT_MIN for default
+ */
+std::unique_ptr<Column> make_column(
+    PyObject* output,
+    PyObject* mask,
+    Py_ssize_t rows,
+    const Replacements& replacements,
+    bool allow_underscores,
     const int base = std::numeric_limits<int>::min()
-) noexcept(false);
\ No newline at end of file
+) noexcept(false);
+
+/**
+ * \brief Parse the fields of each record of delimited text into arrays
+ *
+ * \param reader The reader of the delimited text, positioned before the
+ *               first record to parse
+ * \param rows The number of records to parse
+ * \param columns The column to fill from each field, or nullptr to skip
+ *                the field - fields after the last column are skipped
+ */
+void delimited_impl(
+    DelimitedReader& reader, Py_ssize_t rows, const std::vector<Column*>& columns
+) noexcept(false);
+
+/**
+ * \brief Parse the fields of each record of fixed-width text into arrays
+ *
+ * \param reader The reader of the fixed-width text, positioned before the
+ *               first record to parse
+ * \param rows The number of records to parse
+ * \param ranges The start and end (exclusive) of each field within a record
+ * \param columns The column to fill from each field
+ */
+void fixed_width_impl(
+    FixedWidthReader& reader,
+    Py_ssize_t rows,
+    const std::vector<std::pair<std::size_t, std::size_t>>& ranges,
+    const std::vector<Column*>& columns
+) noexcept(false);
+
+/**
+ * \brief Convert the fields of each row of Python objects into arrays
+ *
+ * \param input The sequence of rows, each a sequence with a field for each column
+ * \param columns The column to fill from each field
+ */
+void rows_impl(PyObject* input, const std::vector<Column*>& columns) noexcept(false);
+
+/**
+ * \brief Parse the numbers of a JSON array into arrays
+ *
+ * Null is converted as None is, i.e. it is a type error.
+ *
+ * \param reader The reader of the JSON array
+ * \param rows The number of values or nested arrays the array must have
+ * \param columns The column to fill from each position of the nested
+ *                arrays, or the only column if the array is not nested
+ */
+void json_impl(
+    JsonArrayReader& reader, Py_ssize_t rows, const std::vector<Column*>& columns
+) noexcept(false);
+
+/**
+ * \brief Create the key that sorts an object in natural order
+ *
+ * A str is split into a tuple of alternating text and numbers, which
+ * starts with text (which is empty if the str starts with a number).
+ * An int or float is sorted as a str containing only that number.
+ *
+ * \param input The object to create the key of
+ * \param options How numbers are found within text
+ * \param casefold Whether or not to casefold text, for case-insensitive order
+ */
+PyObject* natsort_key_impl(
+    PyObject* input, const NaturalOptions& options, const bool casefold
+) noexcept(false);
+
+/**
+ * \brief Create the key that sorts each object of an iterable in natural order
+ *
+ * \param input The iterable of objects to create the keys of
+ * \param options How numbers are found within text
+ * \param casefold Whether or not to casefold text, for case-insensitive order
+ */
+PyObject* natsort_keys_impl(
+    PyObject* input, const NaturalOptions& options, const bool casefold
+) noexcept(false);
+
+/**
+ * \brief Compare two objects in natural order, as their keys would be
+ *
+ * Two str are compared chunk by chunk in place, without creating keys.
+ *
+ * \param a The first object to compare
+ * \param b The second object to compare
+ * \param options How numbers are found within text
+ * \param casefold Whether or not to casefold text, for case-insensitive order
+ * \return -1, 0 or 1 if a sorts before, with or after b
+ */
+PyObject* natcmp_impl(
+    PyObject* a, PyObject* b, const NaturalOptions& options, const bool casefold
+) noexcept(false);
+
+/**
+ * \brief Sort the objects of an iterable in natural order into a new list
+ *
+ * The sort is stable. If every object (or result of the key function) is
+ * a str, they are compared in place without creating keys.
+ *
+ * \param input The iterable of objects to sort
+ * \param key A function to apply to each object before comparing, or None
+ * \param reverse Whether or not to sort from last to first
+ * \param options How numbers are found within text
+ * \param casefold Whether or not to casefold text, for case-insensitive order
+ */
+PyObject* natsorted_impl(
+    PyObject* input,
+    PyObject* key,
+    const bool reverse,
+    const NaturalOptions& options,
+    const bool casefold
+) noexcept(false);
+
+/**
+ * \brief Find the numbers within the text of a str
+ *
+ * Numbers are found with the same grammar as for natural sorting, and
+ * are returned in the order they appear.
+ *
+ * \param input The str to search
+ * \param ntype The type of number to find - REAL, FLOAT or INT
+ * \param options Whether or not numbers may be signed or have an exponent
+ * \param offsets Whether or not to give each number with its start and end
+ * \return A list of the numbers (or of tuples of each number and its offsets)
+ */
+PyObject* find_numbers_impl(
+    PyObject* input, const UserType ntype, NaturalOptions options, const bool offsets
+) noexcept(false);
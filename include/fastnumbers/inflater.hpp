@@ -0,0 +1,153 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <thread>
+
+#include <Python.h>
+
+/// The zlib decompression state (opaque, so zlib is not needed to include this)
+struct z_stream_s;
+
+/**
+ * \class Inflater
+ * \brief Decompress gzip or zlib compressed input in blocks of bounded size
+ *
+ * The compressed input is read from a Python file object's read method,
+ * and decompressed with zlib into two reusable buffers. While the caller
+ * handles one block, the next is decompressed into the other buffer by a
+ * worker thread that never touches the Python interpreter. Like the gzip
+ * module, multiple concatenated compressed streams are accepted.
+ *
+ * zlib is found when fastnumbers is built. If it was not, constructing an
+ * Inflater raises a RuntimeError.
+ */
+class Inflater {
+public:
+    /**
+     * \brief Prepare to decompress input
+     * \param read The read method of a binary file object - it must
+     *             outlive this object
+     * \param block_size The maximum size of the compressed blocks to read
+     *                   and of the decompressed blocks to give
+     * \param threads Whether or not to decompress in a worker thread
+     */
+    Inflater(PyObject* read, const std::size_t block_size, const bool threads)
+        noexcept(false);
+
+    // Cannot copy, because the worker refers to the object
+    Inflater(const Inflater&) = delete;
+    Inflater(Inflater&&) = delete;
+    Inflater& operator=(const Inflater&) = delete;
+
+    /// Stop the worker and free the decompression state - needs the GIL
+    ~Inflater() noexcept;
+
+    /**
+     * \brief Give the next block of decompressed text
+     *
+     * The GIL must be held to call this, and is released while waiting
+     * for the worker. The block is only valid until this is called again.
+     *
+     * \return The next non-empty block, or std::nullopt once the input
+     *         is exhausted
+     */
+    std::optional<std::string_view> next() noexcept(false);
+
+private:
+    /// The outcome of decompressing a block
+    enum class Status {
+        /// The block is full and there may be more output
+        FULL,
+        /// All input was used, but the compressed stream has not ended
+        NEED_INPUT,
+        /// All input was used, and the compressed stream has ended
+        STREAM_END,
+        /// The compressed input is corrupt
+        CORRUPT,
+    };
+
+    /// Deletes the decompression state
+    struct StreamDeleter {
+        void operator()(z_stream_s* stream) const noexcept;
+    };
+
+    /// Read the next compressed input, returning false at the end of the file
+    bool read() noexcept(false);
+
+    /// Start decompressing into the block that is not being handled
+    void start() noexcept(false);
+
+    /// Wait for the block being decompressed to be finished
+    void wait() noexcept;
+
+    /// Decompress into the block that is being filled - never uses Python
+    void inflate() noexcept;
+
+    /// The loop of the worker thread
+    void work() noexcept;
+
+    /// The read method of the input
+    PyObject* m_read;
+
+    /// The size of blocks
+    std::size_t m_block_size;
+
+    /// Whether or not to decompress in a worker thread
+    bool m_threads;
+
+    /// The decompression state
+    std::unique_ptr<z_stream_s, StreamDeleter> m_stream;
+
+    /// The compressed input being decompressed
+    Py_buffer m_input;
+
+    /// Whether or not compressed input is held
+    bool m_has_input;
+
+    /// The compressed input not yet given to zlib
+    std::string_view m_unread;
+
+    /// Whether or not any input has been read
+    bool m_started;
+
+    /// Whether or not the input is exhausted
+    bool m_finished;
+
+    /// Whether or not the current compressed stream has ended
+    bool m_stream_ended;
+
+    /// The outcome of decompressing the block being filled
+    Status m_status;
+
+    /// The message of zlib if the input is corrupt
+    const char* m_error;
+
+    /// The storage of the decompressed blocks, which is allocated once
+    std::unique_ptr<char[]> m_blocks[2];
+
+    /// The number of decompressed bytes in each block
+    std::size_t m_lengths[2];
+
+    /// The index of the block being filled
+    std::size_t m_filling;
+
+    /// Guards m_pending and m_quit
+    std::mutex m_mutex;
+
+    /// Signals changes to m_pending and m_quit
+    std::condition_variable m_changed;
+
+    /// Whether or not a block is being filled
+    bool m_pending;
+
+    /// Whether or not the worker should stop
+    bool m_quit;
+
+    /// The worker thread, if it has been started
+    std::thread m_worker;
+};
@@ -1,7 +1,11 @@
 #pragma once
 
+#include <cstring>
 #include <functional>
 #include <optional>
+#include <string_view>
+#include <type_traits>
+#include <utility>
 
 #include <Python.h>
 
@@ -9,7 +13,7 @@
 #include "fastnumbers/selectors.hpp"
 
 /// Obtain the length hint from a Python object
-Py_ssize_t get_length_hint(PyObject* length_hint_base) noexcept(false)
+inline Py_ssize_t get_length_hint(PyObject* length_hint_base) noexcept(false)
 {
     Py_ssize_t length_hint = PyObject_LengthHint(length_hint_base, 0);
     if (length_hint < 0) {
@@ -21,24 +25,32 @@ Py_ssize_t get_length_hint(PyObject* length_hint_base) noexcept(false)
 /**
  * \class ListBuilder
  * \brief Handles the details of creating and managing a Python list
+ *
+ * The items are collected in an array that grows geometrically, and are
+ * given to a list of exactly the right size at the end. A length hint is
+ * only used as the initial capacity, so a wrong (or missing) hint costs
+ * at most a few reallocations and never leaves empty slots in the list.
+ * The items are owned by the builder until they are given to the caller
+ * with release().
  */
 class ListBuilder {
 public:
     /**
-     * \brief Construct the manager with a list of a fixed size
-     * \param length The initial length of the list to construct
+     * \brief Construct the manager with an initial capacity
+     * \param capacity The number of items expected in the list
      */
-    explicit ListBuilder(const Py_ssize_t length) noexcept(false)
-        : m_list(PyList_New(length))
-        , m_index(0)
+    explicit ListBuilder(const Py_ssize_t capacity) noexcept(false)
+        : m_items(nullptr)
+        , m_size(0)
+        , m_capacity(0)
     {
-        if (m_list == nullptr) {
+        if (!reserve(capacity < MIN_CAPACITY ? MIN_CAPACITY : capacity)) {
             throw exception_is_set();
         }
     }
 
     /**
-     * \brief Construct the manager with a list of a size based
+     * \brief Construct the manager with a capacity based
      *         on a hint from another object
      * \param length The object with the length hint
      */
@@ -51,47 +63,83 @@ public:
     ListBuilder(ListBuilder&&) = delete;
     ListBuilder& operator=(const ListBuilder&) = delete;
 
-    // Default
-    ~ListBuilder() = default;
+    /// Destroy any items that were never released
+    ~ListBuilder() noexcept
+    {
+        for (Py_ssize_t i = 0; i < m_size; ++i) {
+            Py_DECREF(m_items[i]);
+        }
+        PyMem_Free(m_items);
+    }
 
     /**
      * \brief Add an item to the end of the list
-     * \param item The item to add to the list
+     * \param item The item to add to the list (the reference is stolen),
+     *             or NULL if a Python exception is set
+     * \return false if a Python exception is set, true otherwise
      */
-    void append(PyObject* item) noexcept(false)
+    bool append(PyObject* item) noexcept
     {
         // Protect against incoming NULLs.
         if (item == nullptr) {
-            throw exception_is_set();
+            return false;
         }
 
-        // The list may have been pre-allocated using the length hint.
-        // If so, the elements will be just populated with NULL.
-        // If the current index equals the list size, that means we are
-        // at the end of the list and we can just use append. Otherwise,
-        // we insert the object directly into the list, replacing NULL.
-        if (PyList_GET_SIZE(m_list) == m_index) {
-            if (PyList_Append(m_list, item)) {
-                Py_DECREF(m_list);
-                throw exception_is_set();
-            }
-        } else {
-            PyList_SET_ITEM(m_list, m_index, item);
+        // Grow geometrically so that the cost of growing is amortized
+        if (m_size == m_capacity && !reserve(m_capacity * 2)) {
+            Py_DECREF(item);
+            return false;
         }
-
-        // Increment the index of where we are currently at in the list.
-        m_index += 1;
+        m_items[m_size] = item;
+        m_size += 1;
+        return true;
     }
 
-    /// Return the stored list to the user
-    PyObject* get() noexcept { return m_list; }
+    /// Give the items to the user in a list, or NULL if a Python exception is set
+    PyObject* release() noexcept
+    {
+        PyObject* list = PyList_New(m_size);
+        if (list == nullptr) {
+            return nullptr;
+        }
+        for (Py_ssize_t i = 0; i < m_size; ++i) {
+            PyList_SET_ITEM(list, i, m_items[i]);
+        }
+        m_size = 0;
+        return list;
+    }
 
 private:
-    /// The list itself
-    PyObject* m_list;
+    /// The smallest capacity that will be allocated
+    static constexpr Py_ssize_t MIN_CAPACITY = 8;
 
-    /// The current location where we should add to the list
-    Py_ssize_t m_index;
+    /// The items that will be placed in the list
+    PyObject** m_items;
+
+    /// The number of items stored
+    Py_ssize_t m_size;
+
+    /// The number of items that can be stored without growing
+    Py_ssize_t m_capacity;
+
+private:
+    /// Change the capacity, returning false if a Python exception is set
+    bool reserve(const Py_ssize_t capacity) noexcept
+    {
+        constexpr Py_ssize_t item_size = sizeof(PyObject*);
+        void* items = nullptr;
+        if (capacity <= PY_SSIZE_T_MAX / item_size) {
+            const auto nbytes = static_cast<std::size_t>(capacity * item_size);
+            items = PyMem_Realloc(m_items, nbytes);
+        }
+        if (items == nullptr) {
+            PyErr_NoMemory();
+            return false;
+        }
+        m_items = static_cast<PyObject**>(items);
+        m_capacity = capacity;
+        return true;
+    }
 };
 
 /**
@@ -108,7 +156,7 @@ public:
     explicit ArrayPopulator(Py_buffer& buffer, const Py_ssize_t length) noexcept(false)
         : m_buf(buffer)
         , m_index(0)
-        , m_stride(m_buf.strides != nullptr ? (m_buf.strides[0] / m_buf.itemsize) : 1)
+        , m_stride(m_buf.strides != nullptr ? m_buf.strides[0] : m_buf.itemsize)
     {
         if (m_buf.ndim != 1) {
             PyErr_SetString(PyExc_ValueError, "Can only accept arrays of dimension 1");
@@ -133,10 +181,54 @@ public:
     template <typename T>
     void place_next(const T value) noexcept
     {
-        *(static_cast<T*>(m_buf.buf) + (m_index * m_stride)) = value;
+        place_at(m_index, value);
         m_index += 1;
     }
 
+    /// \brief Place a return value at the given location of the buffer
+    /// \param index The location at which to place the value
+    /// \param value The value to place
+    template <typename T>
+    void place_at(const Py_ssize_t index, const T value) noexcept
+    {
+        // The location may not be aligned (e.g. a field of a packed record array)
+        char* location = static_cast<char*>(m_buf.buf) + (index * m_stride);
+        std::memcpy(location, &value, sizeof(T));
+    }
+
+    /// The location where the next value will be placed
+    Py_ssize_t index() const noexcept { return m_index; }
+
+    /// \brief Cast and place many values at once starting at the next location
+    /// \param data The start of the values to place
+    /// \param stride The distance between values in data
+    /// \param length The number of values to place
+    template <typename T, typename U>
+    void place_all(const U* data, const Py_ssize_t stride, const Py_ssize_t length)
+        noexcept
+    {
+        // Python converts integers to double, so do the same
+        using Intermediate = std::conditional_t<
+            std::is_floating_point_v<T> && std::is_integral_v<U>,
+            double,
+            U>;
+
+        if (stride == 1 && m_stride == static_cast<Py_ssize_t>(sizeof(T))) {
+            // Contiguous loop is simple enough for the compiler to vectorize
+            T* out = reinterpret_cast<T*>(
+                static_cast<char*>(m_buf.buf) + (m_index * m_stride)
+            );
+            for (Py_ssize_t i = 0; i < length; ++i) {
+                out[i] = static_cast<T>(static_cast<Intermediate>(data[i]));
+            }
+            m_index += length;
+        } else {
+            for (Py_ssize_t i = 0; i < length; ++i) {
+                place_next(static_cast<T>(static_cast<Intermediate>(data[i * stride])));
+            }
+        }
+    }
+
 private:
     /// The buffer where the data should be added
     Py_buffer& m_buf;
@@ -144,7 +236,7 @@ private:
     /// The current location where we should add to the array
     Py_ssize_t m_index;
 
-    /// Offset to use when determining the index
+    /// The distance in bytes between the locations of consecutive indices
     Py_ssize_t m_stride;
 };
 
@@ -157,24 +249,34 @@ enum class IterState {
 /**
  * \class IterableManager
  * \brief Makes iteration over a Python iterable with a ranged for loop possible
+ *
+ * The type of the conversion function is a template parameter so that the
+ * conversion can be inlined into the iteration. Type erasure with
+ * std::function is only needed when the manager must be stored somewhere
+ * that cannot know the function type, such as in a Python iterator object.
  */
-template <typename PayloadType>
+template <
+    typename PayloadType,
+    typename Function = std::function<PayloadType(PyObject*)>>
 class IterableManager {
 public:
     /// Constructor
-    explicit IterableManager(
-        PyObject* potential_iterable, std::function<PayloadType(PyObject*)> convert
-    ) noexcept(false)
+    explicit IterableManager(PyObject* potential_iterable, Function convert)
+        noexcept(false)
         : m_object(potential_iterable)
         , m_iterator(nullptr)
         , m_fast_sequence(nullptr)
+        , m_object_view { nullptr, nullptr }
+        , m_object_data(nullptr)
         , m_index(0)
         , m_seq_size(0)
-        , m_convert(convert)
+        , m_convert(std::move(convert))
     {
         if (PyList_Check(m_object) || PyTuple_Check(m_object)) {
             m_fast_sequence = m_object;
             m_seq_size = PySequence_Fast_GET_SIZE(m_fast_sequence);
+        } else if (view_object_buffer()) {
+            m_seq_size = m_object_view.shape[0];
         } else {
             if ((m_iterator = PyObject_GetIter(m_object)) == nullptr) {
                 throw exception_is_set();
@@ -186,6 +288,9 @@ public:
     ~IterableManager() noexcept
     {
         Py_XDECREF(m_iterator);
+        if (m_object_data != nullptr) {
+            PyBuffer_Release(&m_object_view);
+        }
 
         // It's possible the fast sequence *is* the object... only decrement
         // the reference if this is not the case.
@@ -203,7 +308,7 @@ public:
     /// data into a list in order to find the size.
     Py_ssize_t get_size() noexcept(false)
     {
-        if (m_fast_sequence != nullptr) {
+        if (m_fast_sequence != nullptr || m_object_data != nullptr) {
             return m_seq_size;
         } else if (PySequence_Check(m_object)) {
             return PySequence_Size(m_object);
@@ -232,6 +337,69 @@ public:
         }
     }
 
+    /**
+     * \brief Return the exact type shared by every element
+     *
+     * This is only known for objects whose elements can be inspected
+     * up-front without consuming them (e.g. list, tuple, object arrays),
+     * including iterables that were stored in a list by get_size().
+     *
+     * \return The shared type, or nullptr if not shared or not known
+     */
+    PyTypeObject* homogeneous_type() const noexcept
+    {
+        if (m_index != 0 || m_seq_size == 0 || m_iterator != nullptr) {
+            return nullptr;
+        }
+        PyTypeObject* type = Py_TYPE(item_at(0));
+        for (Py_ssize_t i = 1; i < m_seq_size; ++i) {
+            if (Py_TYPE(item_at(i)) != type) {
+                return nullptr;
+            }
+        }
+        return type;
+    }
+
+    /// Change the function used to convert the remaining elements
+    void set_converter(Function convert) noexcept
+    {
+        m_convert = std::move(convert);
+    }
+
+    /**
+     * \brief Whether or not the elements are accessed without consuming an iterator
+     *
+     * If so, converting elements before they are requested has no effect
+     * on the input.
+     */
+    bool has_direct_access() const noexcept { return m_iterator == nullptr; }
+
+    /**
+     * \brief Obtain the next element of the input without converting it
+     *
+     * This is an alternative to iterating with begin() and end() for
+     * callers that manage the conversion themselves - see convert().
+     *
+     * \return A new reference to the element, or nullptr at the end of
+     *         the input or if a Python exception is set
+     */
+    PyObject* next_item() noexcept
+    {
+        if (m_iterator != nullptr) {
+            return PyIter_Next(m_iterator);
+        }
+        if (m_index == m_seq_size) {
+            return nullptr;
+        }
+        PyObject* item = item_at(m_index);
+        m_index += 1;
+        Py_INCREF(item);
+        return item;
+    }
+
+    /// Convert an element obtained with next_item()
+    PayloadType convert(PyObject* item) noexcept(false) { return m_convert(item); }
+
     /**
      * \class ItemIterator
      * \brief An iterator over the IterableManager
@@ -335,6 +503,13 @@ private:
     /// NULL if not a fast sequence (e.g. list/tuple), the fast sequence object otherwise
     PyObject* m_fast_sequence;
 
+    /// The buffer view of the object if it is an array of Python objects
+    Py_buffer m_object_view;
+
+    /// NULL if not an array of Python objects (e.g. numpy object arrays),
+    /// the start of the array's PyObject* data otherwise
+    const char* m_object_data;
+
     /// The location we are in the sequence, if the input is a sequence
     Py_ssize_t m_index;
 
@@ -342,15 +517,75 @@ private:
     Py_ssize_t m_seq_size;
 
     /// The function used to convert data
-    std::function<PayloadType(PyObject*)> m_convert;
+    Function m_convert;
 
 private:
+    /**
+     * \brief Attempt to view the object as a 1D buffer of PyObject*
+     *
+     * Object arrays (like a numpy array of dtype object, which is what
+     * backs pandas object columns) hold borrowed references to their
+     * elements which may be read directly, just like a list.
+     *
+     * \return true if the object could be viewed as such a buffer
+     */
+    bool view_object_buffer() noexcept
+    {
+        if (!PyObject_CheckBuffer(m_object)) {
+            return false;
+        }
+        constexpr auto flags = PyBUF_STRIDES | PyBUF_FORMAT;
+        if (PyObject_GetBuffer(m_object, &m_object_view, flags) != 0) {
+            PyErr_Clear();
+            return false;
+        }
+        const bool is_object_array = m_object_view.ndim == 1
+            && m_object_view.format != nullptr
+            && std::string_view(m_object_view.format) == "O"
+            && m_object_view.itemsize == sizeof(PyObject*);
+        if (!is_object_array) {
+            PyBuffer_Release(&m_object_view);
+            return false;
+        }
+        m_object_data = static_cast<const char*>(m_object_view.buf);
+        return true;
+    }
+
+    /**
+     * \brief Access an element of a fast sequence or object array directly.
+     *
+     * The returned object is a borrowed reference, so we do not
+     * need to manage the reference counts.
+     */
+    PyObject* item_at(const Py_ssize_t index) const noexcept
+    {
+        if (m_object_data != nullptr) {
+            PyObject* item = nullptr;
+            const char* location = m_object_data + index * m_object_view.strides[0];
+            std::memcpy(&item, location, sizeof(PyObject*));
+
+            // Object arrays may contain NULL to represent None
+            return item == nullptr ? Py_None : item;
+        }
+        return PySequence_Fast_GET_ITEM(m_fast_sequence, index);
+    }
+
+    /**
+     * \brief Convert the next element
+     *
+     * So that the iteration does not throw, a failure is returned as a
+     * default-constructed payload (e.g. NULL or std::nullopt, which is
+     * what the conversion function returns on failure) with a Python
+     * exception set.
+     *
+     * \return The converted element, or std::nullopt if there are no more
+     */
     std::optional<PayloadType> next() noexcept(false)
     {
         PyObject* item = nullptr;
 
-        // If no iterator is stored, then the object was a fast sequence and
-        // we can access the data directly.
+        // If no iterator is stored, then the object was a fast sequence
+        // or an array of Python objects and we can access the data directly.
         if (m_iterator == nullptr) {
             // When at the end of the sequence, return the sigil
             if (m_index == m_seq_size) {
@@ -358,9 +593,7 @@ private:
             }
 
             // Access the data in the input sequence directly.
-            // The returned object is a borrowed reference, so we do not
-            // need to manage the reference counts.
-            item = PySequence_Fast_GET_ITEM(m_fast_sequence, m_index);
+            item = item_at(m_index);
 
             // Before moving on, increment our internal counter.
             m_index += 1;
@@ -373,11 +606,11 @@ private:
         // protocol to get each next item.
         // When a nullptr is returned with no exception set then it is the end
         // of the iteration and we return return the sigil. If an exception is
-        // set, well, we need to raise it.
+        // set, well, we need to report it.
         if ((item = PyIter_Next(m_iterator)) == nullptr) {
             // StopIteration is already cleared by PyIter_Next()
             if (PyErr_Occurred()) {
-                throw exception_is_set();
+                return PayloadType();
             }
             return std::nullopt;
         }
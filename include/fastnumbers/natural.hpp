@@ -0,0 +1,383 @@
+#pragma once
+
+#include <string>
+
+#include <Python.h>
+
+#include "fastnumbers/c_str_parsing.hpp"
+
+/// How numbers are found within text
+struct NaturalOptions {
+    /// Whether or not a '+' or '-' immediately before a number is part of it
+    bool is_signed = false;
+
+    /// Whether or not numbers may have a decimal point (and so are floats)
+    bool real = false;
+
+    /// Whether or not numbers with a decimal point may have an exponent
+    bool exponent = true;
+};
+
+/**
+ * \class NaturalText
+ * \brief Find the numbers within the text of a Python str
+ *
+ * A number is a run of decimal digits (including those of other scripts,
+ * like Python's int), optionally with a sign, and optionally with a decimal
+ * point (digits are needed on at least one side) and an exponent. Anything
+ * else is text. This is a single left-to-right scan, so a number ends where
+ * the grammar cannot be continued, e.g. "1.2.3" is "1.2" then ".3".
+ *
+ * The Python interpreter is not called, so scanning may be done without
+ * holding the GIL as long as the str is kept alive.
+ */
+class NaturalText {
+public:
+    /**
+     * \brief Prepare to scan the text of a str
+     * \param str The str to scan - it must outlive this object
+     * \param options How numbers are found
+     */
+    NaturalText(PyObject* str, const NaturalOptions& options) noexcept
+        : m_kind(PyUnicode_KIND(str))
+        , m_data(PyUnicode_DATA(str))
+        , m_size(PyUnicode_GET_LENGTH(str))
+        , m_options(options)
+    { }
+
+    // Default copy/assignment and destructor
+    NaturalText(const NaturalText&) = default;
+    NaturalText(NaturalText&&) = default;
+    NaturalText& operator=(const NaturalText&) = default;
+    ~NaturalText() = default;
+
+    /// The number of code points of the text
+    Py_ssize_t size() const noexcept { return m_size; }
+
+    /// The code point at a position
+    Py_UCS4 at(const Py_ssize_t pos) const noexcept
+    {
+        return PyUnicode_READ(m_kind, m_data, pos);
+    }
+
+    /// The value of the decimal digit at a position, or -1 if it is not a digit
+    int digit(const Py_ssize_t pos) const noexcept
+    {
+        const Py_UCS4 c = at(pos);
+        return c < 128 ? to_digit<int>(static_cast<char>(c)) : Py_UNICODE_TODECIMAL(c);
+    }
+
+    /**
+     * \brief Find the next number
+     * \param pos The position from which to search
+     * \param length Where to store the length of the number, if one is found
+     * \return The position of the number, or size() if there is none
+     */
+    Py_ssize_t find_number(Py_ssize_t pos, Py_ssize_t& length) const noexcept
+    {
+        for (; pos < m_size; ++pos) {
+            length = number_at(pos);
+            if (length > 0) {
+                return pos;
+            }
+        }
+        return m_size;
+    }
+
+    /**
+     * \brief The length of the number at a position
+     * \param pos The position of the number
+     * \return The length, or 0 if there is no number at the position
+     */
+    Py_ssize_t number_at(const Py_ssize_t pos) const noexcept
+    {
+        Py_ssize_t end = pos;
+        if (m_options.is_signed && end < m_size && is_sign_at(end)) {
+            end += 1;
+        }
+        const Py_ssize_t whole = digits_from(end);
+        end += whole;
+        if (!m_options.real) {
+            return whole > 0 ? end - pos : 0;
+        }
+
+        if (end < m_size && at(end) == '.') {
+            const Py_ssize_t fraction = digits_from(end + 1);
+            if (whole == 0 && fraction == 0) {
+                return 0;
+            }
+            end += 1 + fraction;
+        } else if (whole == 0) {
+            return 0;
+        }
+
+        // The exponent is only part of the number if it has digits
+        if (m_options.exponent && end < m_size && (at(end) == 'e' || at(end) == 'E')) {
+            Py_ssize_t exponent = end + 1;
+            if (exponent < m_size && is_sign_at(exponent)) {
+                exponent += 1;
+            }
+            const Py_ssize_t count = digits_from(exponent);
+            if (count > 0) {
+                end = exponent + count;
+            }
+        }
+        return end - pos;
+    }
+
+    /**
+     * \brief Write a number as ASCII text that the C string parsers accept
+     *
+     * Digits of other scripts are written as ASCII digits, and a leading
+     * '+' is dropped.
+     *
+     * \param pos The position of the number
+     * \param length The length of the number
+     * \param buffer Where to write the text
+     */
+    void to_ascii(const Py_ssize_t pos, const Py_ssize_t length, std::string& buffer)
+        const noexcept(false)
+    {
+        buffer.clear();
+        for (Py_ssize_t i = pos; i < pos + length; ++i) {
+            const int value = digit(i);
+            if (value >= 0) {
+                buffer.push_back(static_cast<char>('0' + value));
+            } else if (i != pos || at(i) != '+') {
+                buffer.push_back(static_cast<char>(at(i)));
+            }
+        }
+    }
+
+private:
+    /// The size of each code point
+    int m_kind;
+
+    /// The code points
+    const void* m_data;
+
+    /// The number of code points
+    Py_ssize_t m_size;
+
+    /// How numbers are found
+    NaturalOptions m_options;
+
+private:
+    /// Whether or not there is a sign at a position
+    bool is_sign_at(const Py_ssize_t pos) const noexcept
+    {
+        const Py_UCS4 c = at(pos);
+        return c == '+' || c == '-';
+    }
+
+    /// The number of decimal digits starting at a position
+    Py_ssize_t digits_from(const Py_ssize_t pos) const noexcept
+    {
+        Py_ssize_t end = pos;
+        while (end < m_size && digit(end) >= 0) {
+            end += 1;
+        }
+        return end - pos;
+    }
+};
+
+/**
+ * \class NaturalComparator
+ * \brief Compare texts in natural order without creating their keys
+ *
+ * Texts are compared chunk by chunk in place, giving the same order as
+ * comparing the keys created by natsort_key (text chunks by code point,
+ * number chunks by value). Integers are compared as digit strings, so no
+ * number object is created however many digits there are.
+ *
+ * The Python interpreter is not called, so comparisons may be done
+ * without holding the GIL.
+ */
+class NaturalComparator {
+public:
+    /**
+     * \brief Prepare to compare texts
+     * \param options How numbers are found - they must match those of the texts
+     */
+    explicit NaturalComparator(const NaturalOptions& options) noexcept
+        : m_options(options)
+        , m_buffer_a()
+        , m_buffer_b()
+    { }
+
+    /**
+     * \brief Compare two texts
+     * \param a The first text
+     * \param b The second text
+     * \return Negative if a sorts before b, positive if after, or 0 if neither
+     */
+    int compare(const NaturalText& a, const NaturalText& b) noexcept(false)
+    {
+        // Identical leading code points compare equal, so they can be skipped,
+        // except those that may be part of a number that continues past them
+        Py_ssize_t start = 0;
+        const Py_ssize_t shortest = a.size() < b.size() ? a.size() : b.size();
+        while (start < shortest && a.at(start) == b.at(start)) {
+            start += 1;
+        }
+        while (start > 0 && in_number(a, start - 1)) {
+            start -= 1;
+        }
+
+        // Both texts are walked together, so the text before each number
+        // is compared as it is scanned
+        Py_ssize_t pos_a = start;
+        Py_ssize_t pos_b = start;
+        while (true) {
+            const bool end_a = pos_a == a.size();
+            const bool end_b = pos_b == b.size();
+            const Py_ssize_t length_a = end_a ? 0 : number_at(a, pos_a);
+            const Py_ssize_t length_b = end_b ? 0 : number_at(b, pos_b);
+
+            // Text continues in both, and the first difference decides
+            if (!end_a && !end_b && length_a == 0 && length_b == 0) {
+                const Py_UCS4 char_a = a.at(pos_a++);
+                const Py_UCS4 char_b = b.at(pos_b++);
+                if (char_a != char_b) {
+                    return char_a < char_b ? -1 : 1;
+                }
+                continue;
+            }
+
+            // Text is followed by a number in both
+            if (length_a > 0 && length_b > 0) {
+                const int number = m_options.real
+                    ? compare_real(a, pos_a, length_a, b, pos_b, length_b)
+                    : compare_integer(a, pos_a, length_a, b, pos_b, length_b);
+                if (number != 0) {
+                    return number;
+                }
+                pos_a += length_a;
+                pos_b += length_b;
+                continue;
+            }
+
+            // Otherwise, the key that ends first (or whose text is shorter)
+            // sorts first, and text sorts after a number
+            if (end_a || end_b) {
+                return static_cast<int>(!end_a) - static_cast<int>(!end_b);
+            }
+            return length_a > 0 ? -1 : 1;
+        }
+    }
+
+private:
+    /// How numbers are found
+    NaturalOptions m_options;
+
+    /// Scratch space for the text of the first real number
+    std::string m_buffer_a;
+
+    /// Scratch space for the text of the second real number
+    std::string m_buffer_b;
+
+private:
+    /// Whether or not the code point at a position may be part of a number
+    bool in_number(const NaturalText& text, const Py_ssize_t pos) const noexcept
+    {
+        const Py_UCS4 c = text.at(pos);
+        if (text.digit(pos) >= 0) {
+            return true;
+        }
+        if (m_options.real) {
+            return c == '.' || c == '+' || c == '-'
+                || (m_options.exponent && (c == 'e' || c == 'E'));
+        }
+        return m_options.is_signed && (c == '+' || c == '-');
+    }
+
+    /// The length of the number at a position, or 0 if there is none
+    Py_ssize_t number_at(const NaturalText& text, const Py_ssize_t pos) const noexcept
+    {
+        // Most text cannot start a number, so check that before the grammar
+        const Py_UCS4 c = text.at(pos);
+        const bool possible = (c >= '0' && c <= '9') || c >= 128
+            || (m_options.is_signed && (c == '+' || c == '-'))
+            || (m_options.real && c == '.');
+        return possible ? text.number_at(pos) : 0;
+    }
+
+    /// Compare two integers by their digits
+    int compare_integer(
+        const NaturalText& a,
+        Py_ssize_t start_a,
+        const Py_ssize_t length_a,
+        const NaturalText& b,
+        Py_ssize_t start_b,
+        const Py_ssize_t length_b
+    ) const noexcept
+    {
+        const Py_ssize_t end_a = start_a + length_a;
+        const Py_ssize_t end_b = start_b + length_b;
+        const bool negative_a = skip_sign(a, start_a);
+        const bool negative_b = skip_sign(b, start_b);
+        skip_zeros(a, start_a, end_a);
+        skip_zeros(b, start_b, end_b);
+
+        // Zero is neither negative nor positive
+        const bool below_a = negative_a && start_a < end_a;
+        const bool below_b = negative_b && start_b < end_b;
+        if (below_a != below_b) {
+            return below_a ? -1 : 1;
+        }
+
+        // Without leading zeros, longer integers have larger magnitudes
+        int magnitude = compare_values(end_a - start_a, end_b - start_b);
+        for (; magnitude == 0 && start_a < end_a; ++start_a, ++start_b) {
+            magnitude = compare_values(a.digit(start_a), b.digit(start_b));
+        }
+        return below_a ? -magnitude : magnitude;
+    }
+
+    /// Compare two real numbers by their values
+    int compare_real(
+        const NaturalText& a,
+        const Py_ssize_t start_a,
+        const Py_ssize_t length_a,
+        const NaturalText& b,
+        const Py_ssize_t start_b,
+        const Py_ssize_t length_b
+    ) noexcept(false)
+    {
+        a.to_ascii(start_a, length_a, m_buffer_a);
+        b.to_ascii(start_b, length_b, m_buffer_b);
+        return compare_values(parse_real(m_buffer_a), parse_real(m_buffer_b));
+    }
+
+    /// Move past the sign of a number, returning whether or not it is negative
+    bool skip_sign(const NaturalText& text, Py_ssize_t& pos) const noexcept
+    {
+        if (!m_options.is_signed || text.digit(pos) >= 0) {
+            return false;
+        }
+        return text.at(pos++) == '-';
+    }
+
+    /// Move past the leading zeros of a number
+    static void
+    skip_zeros(const NaturalText& text, Py_ssize_t& pos, const Py_ssize_t end) noexcept
+    {
+        while (pos < end && text.digit(pos) == 0) {
+            pos += 1;
+        }
+    }
+
+    /// Parse the ASCII text of a real number
+    static double parse_real(const std::string& text) noexcept
+    {
+        bool error = false;
+        return parse_float<double>(text.data(), text.data() + text.size(), error);
+    }
+
+    /// Compare two values with the usual three-way result
+    template <typename T>
+    static int compare_values(const T a, const T b) noexcept
+    {
+        return static_cast<int>(b < a) - static_cast<int>(a < b);
+    }
+};
@@ -0,0 +1,252 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include <Python.h>
+
+#include "fastnumbers/payload.hpp"
+
+/**
+ * \brief Cast a C number to another C number type with fastnumbers semantics
+ *
+ * Floating point values can never be converted to an integer type (the same
+ * as a Python float given to try_array), and integers that do not fit in
+ * the destination type are overflows. Casts to floating point go through
+ * double, the same as converting a Python int.
+ *
+ * \param value The value to cast
+ * \return The cast value, or the reason it could not be cast
+ */
+template <typename T, typename U>
+RawPayload<T> checked_cast(const U value) noexcept
+{
+    if constexpr (std::is_floating_point_v<T> && std::is_integral_v<U>) {
+        // Python converts integers to double, so do the same
+        return static_cast<T>(static_cast<double>(value));
+    } else if constexpr (std::is_floating_point_v<T>) {
+        return static_cast<T>(value);
+    } else if constexpr (std::is_floating_point_v<U>) {
+        return ErrorType::BAD_VALUE;
+    } else {
+        if constexpr (std::is_signed_v<U>) {
+            if (value < 0) {
+                if constexpr (std::is_unsigned_v<T>) {
+                    return ErrorType::OVERFLOW_;
+                } else {
+                    constexpr long long t_min = std::numeric_limits<T>::min();
+                    if (static_cast<long long>(value) < t_min) {
+                        return ErrorType::OVERFLOW_;
+                    }
+                    return static_cast<T>(value);
+                }
+            }
+        }
+
+        // The value is non-negative, so it can be compared as unsigned
+        constexpr unsigned long long t_max = std::numeric_limits<T>::max();
+        if (static_cast<unsigned long long>(value) > t_max) {
+            return ErrorType::OVERFLOW_;
+        }
+        return static_cast<T>(value);
+    }
+}
+
+/**
+ * \class NumericBuffer
+ * \brief Read-only view of a one-dimensional array of C numbers
+ *
+ * Objects such as numpy arrays or array.array of the numeric types
+ * supported by try_array expose their data through the buffer protocol.
+ * This allows converting each element without creating a Python object.
+ */
+class NumericBuffer {
+public:
+    /**
+     * \brief Attempt to view the given object as a numeric buffer
+     *
+     * If the object is not a supported numeric buffer, format() will
+     * return '\0' and no Python exception will be set.
+     *
+     * \param obj The Python object to view
+     */
+    explicit NumericBuffer(PyObject* obj) noexcept
+        : m_view { nullptr, nullptr }
+        , m_format('\0')
+    {
+        // Elements needing resolution are read by indexing the object itself
+        // (its view may be of another object), so it must be a sequence
+        if (!PyObject_CheckBuffer(obj) || !PySequence_Check(obj)) {
+            return;
+        }
+        if (PyObject_GetBuffer(obj, &m_view, PyBUF_STRIDES | PyBUF_FORMAT) != 0) {
+            PyErr_Clear();
+            return;
+        }
+        m_format = format_from_view(m_view);
+        if (m_format == '\0') {
+            PyBuffer_Release(&m_view);
+        }
+    }
+
+    // Cannot copy
+    NumericBuffer(const NumericBuffer&) = delete;
+    NumericBuffer(NumericBuffer&&) = delete;
+    NumericBuffer& operator=(const NumericBuffer&) = delete;
+
+    /// Release the buffer if one was obtained
+    ~NumericBuffer() noexcept
+    {
+        if (m_format != '\0') {
+            PyBuffer_Release(&m_view);
+        }
+    }
+
+    /// The struct-module format character of the elements, or '\0' if invalid
+    char format() const noexcept { return m_format; }
+
+    /// The number of elements in the buffer
+    Py_ssize_t size() const noexcept { return m_view.shape[0]; }
+
+    /// The start of the data, as the C type specified by format()
+    template <typename U>
+    const U* data() const noexcept
+    {
+        return static_cast<const U*>(m_view.buf);
+    }
+
+    /// The distance between elements, in units of the C type specified by format()
+    Py_ssize_t stride() const noexcept { return m_view.strides[0] / m_view.itemsize; }
+
+    /// Return the element at a given index
+    template <typename U>
+    U get(const Py_ssize_t index) const noexcept
+    {
+        return data<U>()[index * stride()];
+    }
+
+    /**
+     * \brief Determine if every element can be cast without any error handling
+     *
+     * This is true if checked_cast would never return an error (or a
+     * value needing replacement) for any element, in which case the
+     * elements can be cast in bulk.
+     *
+     * \param replace_nan_inf Whether NaN or infinity would need replacement
+     */
+    template <typename T, typename U>
+    bool can_cast_all(const bool replace_nan_inf) const noexcept
+    {
+        if constexpr (std::is_floating_point_v<T> && std::is_integral_v<U>) {
+            return true;
+        } else if constexpr (std::is_floating_point_v<T>) {
+            if (!replace_nan_inf) {
+                return true;
+            }
+            // Only the data needs to be checked, so use a cheap check
+            // that can short-circuit on the first non-finite value.
+            for (Py_ssize_t i = 0; i < size(); ++i) {
+                if (!std::isfinite(static_cast<T>(get<U>(i)))) {
+                    return false;
+                }
+            }
+            return true;
+        } else if constexpr (std::is_floating_point_v<U>) {
+            return size() == 0;
+        } else {
+            if (size() == 0) {
+                return true;
+            }
+            // If the smallest and largest values fit, they all fit
+            U low = get<U>(0);
+            U high = low;
+            for (Py_ssize_t i = 1; i < size(); ++i) {
+                const U value = get<U>(i);
+                low = value < low ? value : low;
+                high = value > high ? value : high;
+            }
+            return std::holds_alternative<T>(checked_cast<T>(low))
+                && std::holds_alternative<T>(checked_cast<T>(high));
+        }
+    }
+
+private:
+    /// The buffer containing the elements
+    Py_buffer m_view;
+
+    /// The format character of the elements
+    char m_format;
+
+private:
+    /// Determine if the buffer describes a 1D array of a supported C number type
+    static char format_from_view(const Py_buffer& view) noexcept
+    {
+        if (view.ndim != 1 || view.format == nullptr || view.itemsize == 0) {
+            return '\0';
+        }
+
+        // Only native size and alignment are supported
+        const char* format = view.format;
+        if (*format == '@') {
+            format += 1;
+        }
+        if (format[0] == '\0' || format[1] != '\0') {
+            return '\0';
+        }
+
+        bool ok = false;
+        switch (format[0]) {
+        case 'd':
+            ok = is_valid_view<double>(view);
+            break;
+        case 'f':
+            ok = is_valid_view<float>(view);
+            break;
+        case 'q':
+            ok = is_valid_view<signed long long>(view);
+            break;
+        case 'l':
+            ok = is_valid_view<signed long>(view);
+            break;
+        case 'i':
+            ok = is_valid_view<signed int>(view);
+            break;
+        case 'h':
+            ok = is_valid_view<signed short>(view);
+            break;
+        case 'b':
+            ok = is_valid_view<signed char>(view);
+            break;
+        case 'Q':
+            ok = is_valid_view<unsigned long long>(view);
+            break;
+        case 'L':
+            ok = is_valid_view<unsigned long>(view);
+            break;
+        case 'I':
+            ok = is_valid_view<unsigned int>(view);
+            break;
+        case 'H':
+            ok = is_valid_view<unsigned short>(view);
+            break;
+        case 'B':
+            ok = is_valid_view<unsigned char>(view);
+            break;
+        default:
+            break;
+        }
+        return ok ? format[0] : '\0';
+    }
+
+    /// The data can only be read as an array of U if it is laid out as one
+    template <typename U>
+    static bool is_valid_view(const Py_buffer& view) noexcept
+    {
+        constexpr std::uintptr_t mask = alignof(U) - 1;
+        return view.itemsize == sizeof(U)
+            && (reinterpret_cast<std::uintptr_t>(view.buf) & mask) == 0
+            && view.strides[0] % static_cast<Py_ssize_t>(sizeof(U)) == 0;
+    }
+};
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <Python.h>
+
+/// The category of numpy scalar that was found
+enum class NumpyScalarKind {
+    NONE, ///< The object is not a recognized numpy scalar
+    SIGNED, ///< A signed integer scalar (e.g. numpy.int64)
+    UNSIGNED, ///< An unsigned integer scalar (e.g. numpy.uint8)
+    FLOAT, ///< A floating point scalar (e.g. numpy.float32)
+};
+
+/**
+ * \class NumpyScalar
+ * \brief The raw value stored inside a numpy scalar object
+ *
+ * Numpy scalars store their value directly after the object header, so
+ * once the type is known the value can be read without calling into the
+ * Python number protocol. The numpy types are looked up once when the
+ * module is imported (see load_types()), so numpy is never a requirement.
+ */
+class NumpyScalar {
+public:
+    /// Construct as a non-numpy scalar
+    NumpyScalar() noexcept
+        : m_kind(NumpyScalarKind::NONE)
+        , m_signed(0)
+        , m_unsigned(0)
+        , m_float(0.0)
+    { }
+
+    /**
+     * \brief Look up the numpy scalar types, if numpy is installed
+     *
+     * This is called once at module initialization. Failure to find numpy
+     * (or any of its types) is not an error - the affected types are simply
+     * read through the Python number protocol like any other object. Any
+     * exception that was already set when this is called is preserved.
+     */
+    static void load_types() noexcept;
+
+    /**
+     * \brief Read the raw value from an object if it is a numpy scalar
+     * \param obj The object to inspect
+     * \return A NumpyScalar whose kind() is NONE if obj is not a numpy scalar
+     */
+    static NumpyScalar read(PyObject* obj) noexcept;
+
+    /// The category of the scalar
+    NumpyScalarKind kind() const noexcept { return m_kind; }
+
+    /// Return the value as a double
+    double as_double() const noexcept
+    {
+        switch (m_kind) {
+        case NumpyScalarKind::SIGNED:
+            return static_cast<double>(m_signed);
+        case NumpyScalarKind::UNSIGNED:
+            return static_cast<double>(m_unsigned);
+        default:
+            return m_float;
+        }
+    }
+
+    /// Return the value as a new Python int. Floats are truncated.
+    PyObject* as_pyint() const noexcept
+    {
+        switch (m_kind) {
+        case NumpyScalarKind::SIGNED:
+            return PyLong_FromLongLong(m_signed);
+        case NumpyScalarKind::UNSIGNED:
+            return PyLong_FromUnsignedLongLong(m_unsigned);
+        default:
+            return PyLong_FromDouble(m_float);
+        }
+    }
+
+private:
+    /// The category of the scalar
+    NumpyScalarKind m_kind;
+
+    /// The value if the scalar is signed
+    long long m_signed;
+
+    /// The value if the scalar is unsigned
+    unsigned long long m_unsigned;
+
+    /// The value if the scalar is a float
+    double m_float;
+};
@@ -74,29 +74,41 @@ public:
         return str != m_start && str == (m_start + m_str_len);
     }
 
+    /// Convert the contained value into a number C++
+    template <typename T>
+    RawPayload<T> as_number() const noexcept(false)
+    {
+        return as_number<T>(options());
+    }
+
     /**
      * \brief Convert the contained value into a number C++
      *
      * This template specialization is for integral types.
+     *
+     * \param options The parser's options, which may be a FixedOptions
      */
-    template <typename T, typename std::enable_if_t<std::is_integral_v<T>, bool> = true>
-    RawPayload<T> as_number() const noexcept(false)
+    template <
+        typename T,
+        typename OptionsT,
+        typename std::enable_if_t<std::is_integral_v<T>, bool> = true>
+    RawPayload<T> as_number(const OptionsT& options) const noexcept(false)
     {
         bool error;
         bool overflow;
         constexpr bool always_convert = true;
         T result = parse_int<T>(
-            signed_start(), end(), options().get_base(), error, overflow, always_convert
+            signed_start(), end(), options.get_base(), error, overflow, always_convert
         );
 
         // If an error occured because of underscores or a pesky sign and base prefix
         // combo, remove them and re-parse
-        const bool underscore_error = error && has_valid_underscores();
+        const bool underscore_error = error && has_valid_underscores(options);
         const bool prefix_overflow = overflow && has_base_prefix(m_start, m_str_len);
         if (underscore_error || prefix_overflow) {
             Buffer buffer(signed_start(), signed_len());
-            buffer.remove_valid_underscores(options().get_base() != 10);
-            int base = options().get_base();
+            buffer.remove_valid_underscores(options.get_base() != 10);
+            int base = options.get_base();
             if (base == 0) {
                 base = detect_base(buffer.start(), buffer.end());
             }
@@ -122,17 +134,20 @@ public:
      * \brief Convert the contained value into a number C++
      *
      * This template specialization is for floating point types.
+     *
+     * \param options The parser's options, which may be a FixedOptions
      */
     template <
         typename T,
+        typename OptionsT,
         typename std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
-    RawPayload<T> as_number() const noexcept(false)
+    RawPayload<T> as_number(const OptionsT& options) const noexcept(false)
     {
         bool error;
         T result = parse_float<T>(signed_start(), end(), error);
 
         // If an error occured because of underscores, remove them and re-parse
-        if (error && has_valid_underscores()) {
+        if (error && has_valid_underscores(options)) {
             Buffer buffer(signed_start(), signed_len());
             buffer.remove_valid_underscores();
             result = parse_float<T>(buffer.start(), buffer.end(), error);
@@ -158,6 +173,19 @@ public:
         value = as_number<T>();
     }
 
+    /**
+     * \brief Convert the contained value into a number C++
+     *
+     * You will need to check for conversion errors and overflows.
+     *
+     * \param options The parser's options, which may be a FixedOptions
+     */
+    template <typename T, typename OptionsT>
+    void as_number(RawPayload<T>& value, const OptionsT& options) const noexcept(false)
+    {
+        value = as_number<T>(options);
+    }
+
 private:
     /// The potential start of the character array
     const char* m_start;
@@ -175,7 +203,14 @@ private:
     /// Check if the character array contains valid underscores
     bool has_valid_underscores() const noexcept
     {
-        return options().allow_underscores() && m_str_len > 0
+        return has_valid_underscores(options());
+    }
+
+    /// Check if the character array contains valid underscores with the given options
+    template <typename OptionsT>
+    bool has_valid_underscores(const OptionsT& options) const noexcept
+    {
+        return options.allow_underscores() && m_str_len > 0
             && std::memchr(m_start, '_', m_str_len);
     }
 
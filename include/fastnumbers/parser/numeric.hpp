@@ -6,6 +6,7 @@
 #include <Python.h>
 
 #include "fastnumbers/helpers.hpp"
+#include "fastnumbers/numpy_scalar.hpp"
 #include "fastnumbers/parser/base.hpp"
 #include "fastnumbers/payload.hpp"
 #include "fastnumbers/user_options.hpp"
@@ -20,6 +21,10 @@ public:
     explicit NumericParser(PyObject* obj, const UserOptions& options) noexcept
         : Parser(ParserType::NUMERIC, options)
         , m_obj(obj)
+        , m_numpy(
+              PyFloat_Check(obj) || PyLong_Check(obj) ? NumpyScalar()
+                                                      : NumpyScalar::read(obj)
+          )
     {
         // Store the type of number that was found
         const NumberFlags flags = get_number_type();
@@ -49,6 +54,8 @@ public:
     {
         if (get_number_type() == static_cast<NumberFlags>(NumberType::INVALID)) {
             return ErrorType::TYPE_ERROR;
+        } else if (m_numpy.kind() != NumpyScalarKind::NONE) {
+            return m_numpy.as_pyint();
         }
         return PyNumber_Long(m_obj);
     }
@@ -65,6 +72,11 @@ public:
     {
         if (get_number_type() == static_cast<NumberFlags>(NumberType::INVALID)) {
             return ErrorType::TYPE_ERROR;
+        } else if (m_numpy.kind() != NumpyScalarKind::NONE) {
+            const bool as_int = force_int
+                || (coerce
+                    && (get_number_type() & (NumberType::IntLike | NumberType::Integer)));
+            return as_int ? m_numpy.as_pyint() : PyFloat_FromDouble(m_numpy.as_double());
         } else if (force_int) {
             return PyNumber_Long(m_obj);
         } else if (coerce) {
@@ -94,6 +106,15 @@ public:
             return flag_wrap(NumberType::Integer);
         }
 
+        // Numpy scalars have had their values read directly from the object.
+        // Like any other object with __float__, numpy integers are classified
+        // as (possibly int-like) floats - this only avoids calling __float__.
+        if (m_numpy.kind() != NumpyScalarKind::NONE) {
+            return float_properties(
+                m_numpy.as_double(), NumberType::Float | NumberType::User
+            );
+        }
+
         // In addition to being strictly a float or long, an object can
         // behave like one of those types without being one by defining
         // the __float__, __int__, or __index__ dunder methods.
@@ -135,6 +156,11 @@ public:
                 return ErrorType::TYPE_ERROR;
             }
 
+            // Numpy scalars have had their values read directly from the object
+            if (m_numpy.kind() != NumpyScalarKind::NONE) {
+                return static_cast<T>(m_numpy.as_double());
+            }
+
             // Otherwise use the Python conversion function - this should handle
             // converting integers to double as well. Watch out for errors here too.
             const double value = PyFloat_AsDouble(m_obj);
@@ -203,6 +229,9 @@ private:
     /// The Python object potentially under analysis
     PyObject* m_obj;
 
+    /// The raw value of m_obj if it is a numpy scalar
+    NumpyScalar m_numpy;
+
 private:
     /// Return the object as a double. No error checking is performed.
     double get_double() const noexcept { return PyFloat_AS_DOUBLE(m_obj); }
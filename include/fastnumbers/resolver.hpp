@@ -5,6 +5,7 @@
 
 #include <Python.h>
 
+#include "fastnumbers/deferred.hpp"
 #include "fastnumbers/helpers.hpp"
 #include "fastnumbers/payload.hpp"
 #include "fastnumbers/selectors.hpp"
@@ -28,6 +29,7 @@ public:
         , m_fail(Selectors::RAISE)
         , m_type_error(Selectors::RAISE)
         , m_base(base)
+        , m_deferred(nullptr)
     { }
 
     /// Copy constructor makes sure to increment references
@@ -37,6 +39,7 @@ public:
         , m_fail(Selectors::incref(rhs.m_fail))
         , m_type_error(Selectors::incref(rhs.m_type_error))
         , m_base(rhs.m_base)
+        , m_deferred(rhs.m_deferred)
     { }
 
     /// Move constructor steals object, no need to re-increment
@@ -46,6 +49,7 @@ public:
         , m_fail(std::exchange(rhs.m_fail, nullptr))
         , m_type_error(std::exchange(rhs.m_type_error, nullptr))
         , m_base(std::exchange(rhs.m_base, 0))
+        , m_deferred(std::exchange(rhs.m_deferred, nullptr))
     { }
 
     // Assignment not allowed
@@ -72,6 +76,16 @@ public:
         m_nan = Selectors::incref(nan_value);
     }
 
+    /**
+     * \brief Record calls of the user's callables instead of calling them
+     *
+     * A placeholder value (None) is returned in place of the result of each
+     * call, which must be replaced after calling DeferredCalls::call().
+     *
+     * \param deferred Where to record the calls, or nullptr to call directly
+     */
+    void set_deferred_calls(DeferredCalls* deferred) noexcept { m_deferred = deferred; }
+
     /// Define how a conversion failure will be interpreted
     void set_fail_action(PyObject* fail_value) noexcept
     {
@@ -84,6 +98,34 @@ public:
         m_type_error = Selectors::incref(type_error_value);
     }
 
+    /// Visit the actions for garbage collection
+    int traverse(visitproc visit, void* arg) const noexcept
+    {
+        PyObject* const actions[] = { m_inf, m_nan, m_fail, m_type_error };
+        for (PyObject* action : actions) {
+            if (const int result = Selectors::traverse(action, visit, arg)) {
+                return result;
+            }
+        }
+        return 0;
+    }
+
+    /// Release the actions, restoring the default actions
+    void clear() noexcept
+    {
+        Selectors::reset(m_inf, Selectors::ALLOWED);
+        Selectors::reset(m_nan, Selectors::ALLOWED);
+        Selectors::reset(m_fail, Selectors::RAISE);
+        Selectors::reset(m_type_error, Selectors::RAISE);
+    }
+
+    /// Whether or not any of the actions is a callable
+    bool has_callable_actions() const noexcept
+    {
+        return PyCallable_Check(m_inf) || PyCallable_Check(m_nan)
+            || PyCallable_Check(m_fail) || PyCallable_Check(m_type_error);
+    }
+
     /// Resolve the payload into a Python object
     PyObject* resolve(PyObject* input, const Payload& payload) const noexcept
     {
@@ -150,6 +192,9 @@ private:
     /// Desired integer base - used in error message generation
     int m_base;
 
+    /// Where to record calls of the user's callables, nullptr to call directly
+    DeferredCalls* m_deferred;
+
 private:
     /// Increment the refcount of a non-null object, then return the object
     static PyObject* increment_reference(PyObject* obj) noexcept
@@ -194,7 +239,7 @@ private:
             PyErr_SetString(PyExc_ValueError, "infinity is disallowed");
             return nullptr;
         } else if (PyCallable_Check(my_inf)) {
-            return PyObject_CallFunctionObjArgs(my_inf, input, nullptr);
+            return call(my_inf, "inf", input);
         } else { // handles INPUT and a custom default value
             return increment_reference(my_inf);
         }
@@ -212,7 +257,7 @@ private:
             PyErr_SetString(PyExc_ValueError, "NaN is disallowed");
             return nullptr;
         } else if (PyCallable_Check(my_nan)) {
-            return PyObject_CallFunctionObjArgs(my_nan, input, nullptr);
+            return call(my_nan, "nan", input);
         } else { // handles INPUT and a custom default value
             return increment_reference(my_nan);
         }
@@ -225,7 +270,7 @@ private:
         if (my_fail == Selectors::RAISE) {
             return raise_appropriate_exception(input, atype);
         }
-        return fail_action_impl(input, my_fail);
+        return fail_action_impl(input, my_fail, "on_fail");
     }
 
     /// Return the appropriate value if a conversion failure occured and
@@ -236,7 +281,7 @@ private:
         if (my_fail == Selectors::RAISE) {
             return nullptr; // an error has already been set
         }
-        return fail_action_impl(input, my_fail);
+        return fail_action_impl(input, my_fail, "on_fail");
     }
 
     /// Return the appropriate value if a type error occured
@@ -246,20 +291,35 @@ private:
         if (my_type_error == Selectors::RAISE) {
             return raise_appropriate_exception(input, atype);
         }
-        return fail_action_impl(input, my_type_error);
+        return fail_action_impl(input, my_type_error, "on_type_error");
     }
 
     /// Implementation for non-raising fail action
-    PyObject* fail_action_impl(PyObject* input, PyObject* actionable) const noexcept
+    PyObject* fail_action_impl(
+        PyObject* input, PyObject* actionable, const char* option
+    ) const noexcept
     {
         PyErr_Clear();
         if (PyCallable_Check(actionable)) {
-            return PyObject_CallFunctionObjArgs(actionable, input, nullptr);
+            return call(actionable, option, input);
         } else { // handles INPUT and a custom default value
             return increment_reference(actionable);
         }
     }
 
+    /// Call the user's callable with the input, or defer the call if requested
+    PyObject*
+    call(PyObject* callable, const char* option, PyObject* input) const noexcept
+    {
+        if (m_deferred != nullptr) {
+            if (!m_deferred->add(callable, option, input)) {
+                return nullptr;
+            }
+            return increment_reference(Py_None);
+        }
+        return PyObject_CallFunctionObjArgs(callable, input, nullptr);
+    }
+
     /// Prepare and raise the appropriate exception given an action type
     PyObject*
     raise_appropriate_exception(PyObject* input, const ActionType atype) const noexcept
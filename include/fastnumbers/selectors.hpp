@@ -1,5 +1,7 @@
 #pragma once
 
+#include <utility>
+
 #include <Python.h>
 
 /// Namespace for options selectors
@@ -60,4 +62,19 @@ struct Selectors {
         }
         return obj;
     }
+
+    /// Visit a Python object for garbage collection if the object is not a selector
+    static int traverse(PyObject* obj, visitproc visit, void* arg) noexcept
+    {
+        if (!Selectors::is_selector(obj)) {
+            Py_VISIT(obj);
+        }
+        return 0;
+    }
+
+    /// Replace a held Python object with a selector, releasing the object
+    static void reset(PyObject*& obj, PyObject* selector) noexcept
+    {
+        Selectors::decref(std::exchange(obj, selector));
+    }
 };
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include <Python.h>
+
+#include "fastnumbers/buffer.hpp"
+#include "fastnumbers/extractor.hpp"
+#include "fastnumbers/user_options.hpp"
+
+/// The allocator numpy uses for the data of StringDType arrays (opaque)
+struct npy_string_allocator;
+
+/**
+ * \class StringBuffer
+ * \brief Read-only view of a one-dimensional numpy StringDType array
+ *
+ * Variable-width numpy strings are not stored in the array itself and
+ * have no buffer protocol, so they are read through numpy's NpyString C
+ * API. That API is found when the module is imported (see load_api()),
+ * so numpy is needed neither to build nor to run fastnumbers.
+ *
+ * The elements are read while holding numpy's allocator lock for the
+ * array instead of the GIL. The GIL must never be waited for while
+ * the lock is held, so unlock() must be called before acquiring it.
+ */
+class StringBuffer {
+public:
+    /**
+     * \brief Look up the numpy StringDType C API, if numpy is installed
+     *
+     * This is called once at module initialization. If numpy (version 2
+     * or later) cannot be found, no object is ever viewed as a StringBuffer.
+     * Any exception that was already set when this is called is preserved.
+     */
+    static void load_api() noexcept;
+
+    /**
+     * \brief Attempt to view the given object as a StringDType array
+     *
+     * If the object is not a one-dimensional StringDType array, valid()
+     * will return false and no Python exception will be set.
+     *
+     * \param obj The Python object to view, which must outlive this view
+     */
+    explicit StringBuffer(PyObject* obj) noexcept;
+
+    // Cannot copy
+    StringBuffer(const StringBuffer&) = delete;
+    StringBuffer(StringBuffer&&) = delete;
+    StringBuffer& operator=(const StringBuffer&) = delete;
+
+    /// Release the allocator lock if it is held
+    ~StringBuffer() noexcept { unlock(); }
+
+    /// Whether or not the object is a StringDType array that can be read
+    bool valid() const noexcept { return m_valid; }
+
+    /// The number of elements in the array
+    Py_ssize_t size() const noexcept { return m_size; }
+
+    /**
+     * \brief Return the appropriate parser for a given element
+     *
+     * The Python interpreter is not touched, so this may be called
+     * without holding the GIL. The allocator lock is taken if it is not
+     * already held, and the returned parser is only valid while it is.
+     *
+     * \param index The index of the element to parse
+     * \param buffer The buffer into which to potentially store data
+     * \param options A UserOptions instance containing the options
+     *                specified by the user.
+     * \return The parser, or std::nullopt if the element is null (i.e.
+     *         the array's na_object) or could not be read
+     */
+    std::optional<AnyParser>
+    parser(const Py_ssize_t index, Buffer& buffer, const UserOptions& options)
+        noexcept(false);
+
+    /// Release the allocator lock, if it is held
+    void unlock() noexcept;
+
+private:
+    /// Whether or not the object could be viewed as a StringDType array
+    bool m_valid;
+
+    /// The start of the packed strings
+    const char* m_data;
+
+    /// The distance in bytes between packed strings
+    Py_ssize_t m_stride;
+
+    /// The number of elements in the array
+    Py_ssize_t m_size;
+
+    /// The StringDType instance of the array, which owns the allocator
+    PyObject* m_descr;
+
+    /// The allocator of the array while its lock is held, otherwise nullptr
+    npy_string_allocator* m_allocator;
+
+    /// Storage for elements that contain non-ASCII characters
+    std::vector<Py_UCS4> m_ucs4;
+};
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <Python.h>
+
+#include "fastnumbers/buffer.hpp"
+#include "fastnumbers/c_str_parsing.hpp"
+#include "fastnumbers/extractor.hpp"
+#include "fastnumbers/parser.hpp"
+#include "fastnumbers/user_options.hpp"
+
+/// The type of character data stored in each record of a TextBuffer
+enum class TextKind {
+    NONE, ///< The object is not a fixed-width text buffer
+    BYTES, ///< Each record is an array of char (e.g. numpy.bytes_)
+    UCS4, ///< Each record is an array of UCS4 code points (e.g. numpy.str_)
+};
+
+/**
+ * \class TextBuffer
+ * \brief Read-only view of a one-dimensional fixed-width text array
+ *
+ * Objects such as numpy arrays of dtype "S" or "U" expose their data
+ * through the buffer protocol as fixed-width records. This allows parsing
+ * each record without creating a Python object for each element.
+ */
+class TextBuffer {
+public:
+    /**
+     * \brief Attempt to view the given object as a fixed-width text buffer
+     *
+     * If the object is not a fixed-width text buffer, kind() will
+     * return TextKind::NONE and no Python exception will be set.
+     *
+     * \param obj The Python object to view
+     */
+    explicit TextBuffer(PyObject* obj) noexcept
+        : m_view { nullptr, nullptr }
+        , m_kind(TextKind::NONE)
+    {
+        if (!PyObject_CheckBuffer(obj)) {
+            return;
+        }
+        if (PyObject_GetBuffer(obj, &m_view, PyBUF_STRIDES | PyBUF_FORMAT) != 0) {
+            PyErr_Clear();
+            return;
+        }
+        m_kind = kind_from_view(m_view);
+        if (m_kind == TextKind::NONE) {
+            PyBuffer_Release(&m_view);
+        }
+    }
+
+    // Cannot copy
+    TextBuffer(const TextBuffer&) = delete;
+    TextBuffer(TextBuffer&&) = delete;
+    TextBuffer& operator=(const TextBuffer&) = delete;
+
+    /// Release the buffer if one was obtained
+    ~TextBuffer() noexcept
+    {
+        if (m_kind != TextKind::NONE) {
+            PyBuffer_Release(&m_view);
+        }
+    }
+
+    /// The type of data contained in the records
+    TextKind kind() const noexcept { return m_kind; }
+
+    /// The number of records in the buffer
+    Py_ssize_t size() const noexcept { return m_view.shape[0]; }
+
+    /**
+     * \brief Return the appropriate parser for a given record
+     *
+     * The Python interpreter is not touched, so this may be called
+     * without holding the GIL.
+     *
+     * \param index The index of the record to parse
+     * \param buffer The buffer into which to potentially store data
+     * \param options A UserOptions instance containing the options
+     *                specified by the user.
+     */
+    AnyParser
+    parser(const Py_ssize_t index, Buffer& buffer, const UserOptions& options) const
+        noexcept(false)
+    {
+        const char* data = record(index);
+        if (m_kind == TextKind::BYTES) {
+            std::size_t len = static_cast<std::size_t>(m_view.itemsize);
+            while (len > 0 && data[len - 1] == '\0') {
+                len -= 1;
+            }
+            return CharacterParser(data, len, options);
+        }
+
+        const Py_UCS4* udata = reinterpret_cast<const Py_UCS4*>(data);
+        std::size_t len = static_cast<std::size_t>(m_view.itemsize) / sizeof(Py_UCS4);
+        while (len > 0 && udata[len - 1] == 0) {
+            len -= 1;
+        }
+        return extract_parser(udata, len, buffer, options);
+    }
+
+private:
+    /// The buffer containing the records
+    Py_buffer m_view;
+
+    /// The type of data in the records
+    TextKind m_kind;
+
+private:
+    /// Return the start of a given record
+    const char* record(const Py_ssize_t index) const noexcept
+    {
+        return static_cast<const char*>(m_view.buf) + index * m_view.strides[0];
+    }
+
+    /// Determine if the buffer describes a 1D array of fixed-width text
+    static TextKind kind_from_view(const Py_buffer& view) noexcept
+    {
+        if (view.ndim != 1 || view.format == nullptr || view.itemsize == 0
+            || !PySequence_Check(view.obj)) {
+            return TextKind::NONE;
+        }
+
+        // Parse a struct-module-like format, e.g. "<12w" or "5s".
+        // Non-native byte order is only a problem for UCS4 data.
+        const char* format = view.format;
+        bool native = true;
+        if (*format == '@' || *format == '=') {
+            format += 1;
+        } else if (*format == '<') {
+            native = PY_LITTLE_ENDIAN;
+            format += 1;
+        } else if (*format == '>' || *format == '!') {
+            native = !PY_LITTLE_ENDIAN;
+            format += 1;
+        }
+        while (is_valid_digit(*format)) {
+            format += 1;
+        }
+        if (format[0] == '\0' || format[1] != '\0') {
+            return TextKind::NONE;
+        } else if (format[0] == 's') {
+            return TextKind::BYTES;
+        } else if (format[0] == 'w' && native && is_ucs4_aligned(view)) {
+            return TextKind::UCS4;
+        }
+        return TextKind::NONE;
+    }
+
+    /// UCS4 data can only be read in-place if it is aligned
+    static bool is_ucs4_aligned(const Py_buffer& view) noexcept
+    {
+        constexpr std::uintptr_t mask = alignof(Py_UCS4) - 1;
+        return (reinterpret_cast<std::uintptr_t>(view.buf) & mask) == 0
+            && (static_cast<std::uintptr_t>(view.strides[0]) & mask) == 0;
+    }
+};
@@ -0,0 +1,928 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <Python.h>
+
+#include "fastnumbers/exception.hpp"
+
+/**
+ * \class BytesView
+ * \brief Read-only view of the contiguous bytes of a Python object
+ *
+ * Any object supporting the buffer protocol with contiguous data can be
+ * viewed (e.g. bytes, bytearray, or mmap.mmap), which allows text to be
+ * read without the GIL for as long as this view exists.
+ */
+class BytesView {
+public:
+    /**
+     * \brief View the bytes of the given object
+     * \param obj The Python object to view
+     * \throws exception_is_set if the object does not support the buffer protocol
+     */
+    explicit BytesView(PyObject* obj) noexcept(false)
+        : m_view { nullptr, nullptr }
+    {
+        if (PyObject_GetBuffer(obj, &m_view, PyBUF_SIMPLE) != 0) {
+            throw exception_is_set();
+        }
+    }
+
+    // Cannot copy
+    BytesView(const BytesView&) = delete;
+    BytesView(BytesView&&) = delete;
+    BytesView& operator=(const BytesView&) = delete;
+
+    /// Release the buffer
+    ~BytesView() noexcept { PyBuffer_Release(&m_view); }
+
+    /// The viewed bytes
+    std::string_view text() const noexcept
+    {
+        return std::string_view(
+            static_cast<const char*>(m_view.buf), static_cast<std::size_t>(m_view.len)
+        );
+    }
+
+private:
+    /// The buffer containing the bytes
+    Py_buffer m_view;
+};
+
+/**
+ * \class Tokenizer
+ * \brief Split text into the tokens that are to be parsed as numbers
+ *
+ * The text is split into records on a separator. A trailing empty record
+ * (i.e. the text ends with the separator) is ignored, but all other
+ * records are tokens, even if empty. Optionally, each record may instead
+ * be split into fields on a delimiter, and only one field kept as the token.
+ *
+ * The Python interpreter is never touched, so tokenizing may be done
+ * without holding the GIL.
+ */
+class Tokenizer {
+public:
+    /// Value of the column to indicate the whole record is the token
+    static constexpr Py_ssize_t WHOLE_RECORD = -1;
+
+    /**
+     * \brief Prepare to tokenize text
+     * \param text The text to tokenize - it must outlive this object
+     * \param sep The non-empty separator between records
+     * \param delimiter The non-empty separator between fields of a record
+     * \param column The field of each record to use as a token, or WHOLE_RECORD
+     * \param skip The number of records at the start of the text to ignore
+     * \param lead A complete record that comes before the text, if any -
+     *             it must also outlive this object
+     */
+    Tokenizer(
+        const std::string_view text,
+        const std::string_view sep,
+        const std::string_view delimiter = std::string_view(),
+        const Py_ssize_t column = WHOLE_RECORD,
+        const Py_ssize_t skip = 0,
+        const std::optional<std::string_view> lead = std::nullopt
+    ) noexcept
+        : m_text(text)
+        , m_sep(sep)
+        , m_delimiter(delimiter)
+        , m_column(column)
+        , m_pos(0)
+        , m_lead(lead.value_or(std::string_view()))
+        , m_has_lead(lead.has_value())
+        , m_skipped(0)
+    {
+        for (; m_skipped < skip; ++m_skipped) {
+            if (m_has_lead) {
+                m_has_lead = false;
+            } else if (!next_record(m_pos)) {
+                break;
+            }
+        }
+    }
+
+    // Default copy/assignment and destructor
+    Tokenizer(const Tokenizer&) = default;
+    Tokenizer(Tokenizer&&) = default;
+    Tokenizer& operator=(const Tokenizer&) = default;
+    ~Tokenizer() = default;
+
+    /// The number of tokens that remain
+    Py_ssize_t count() const noexcept
+    {
+        Py_ssize_t total = m_has_lead ? 1 : 0;
+        for (std::size_t pos = m_pos; next_record(pos);) {
+            total += 1;
+        }
+        return total;
+    }
+
+    /// The number of records that were skipped
+    Py_ssize_t skipped() const noexcept { return m_skipped; }
+
+    /**
+     * \brief Obtain the next token
+     * \param token Where to store the token
+     * \return false if there are no more tokens
+     */
+    bool next(std::string_view& token) noexcept
+    {
+        if (m_has_lead) {
+            m_has_lead = false;
+            token = select(m_lead);
+            return true;
+        }
+        const std::size_t start = m_pos;
+        if (!next_record(m_pos)) {
+            return false;
+        }
+        const std::size_t end
+            = m_pos > m_text.size() ? m_text.size() : m_pos - m_sep.size();
+        token = select(m_text.substr(start, end - start));
+        return true;
+    }
+
+private:
+    /// The text to tokenize
+    std::string_view m_text;
+
+    /// The separator between records
+    std::string_view m_sep;
+
+    /// The separator between fields
+    std::string_view m_delimiter;
+
+    /// The field of each record to use as a token
+    Py_ssize_t m_column;
+
+    /// The start of the next record, or past the end of the text if none remain
+    std::size_t m_pos;
+
+    /// The record that comes before the text
+    std::string_view m_lead;
+
+    /// Whether or not the record before the text is still to be read
+    bool m_has_lead;
+
+    /// The number of records that were skipped
+    Py_ssize_t m_skipped;
+
+private:
+    /**
+     * \brief Move a position from the start of a record to the start of the next
+     * \param pos The position to move
+     * \return false if there was no record at the given position
+     */
+    bool next_record(std::size_t& pos) const noexcept
+    {
+        if (pos >= m_text.size()) {
+            return false;
+        }
+        const std::size_t end = m_text.find(m_sep, pos);
+        pos = end == std::string_view::npos ? m_text.size() + 1 : end + m_sep.size();
+        return true;
+    }
+
+    /// Select the token from a record, which is empty if the field does not exist
+    std::string_view select(std::string_view record) const noexcept
+    {
+        if (m_column == WHOLE_RECORD) {
+            return record;
+        }
+        for (Py_ssize_t i = 0; i < m_column; ++i) {
+            const std::size_t end = record.find(m_delimiter);
+            if (end == std::string_view::npos) {
+                return record.substr(record.size());
+            }
+            record.remove_prefix(end + m_delimiter.size());
+        }
+        return record.substr(0, record.find(m_delimiter));
+    }
+};
+
+/**
+ * \class RecordStream
+ * \brief Split text that arrives in chunks into complete records
+ *
+ * Each chunk is staged with stage(), after which tokens() gives the tokens
+ * of the records it completes, and commit() consumes them once they have
+ * been parsed. The complete records are tokenized where they are in the
+ * chunk; only the incomplete record at the end of a chunk is copied, and
+ * is joined with the start of the next chunk up to its first separator.
+ * Feeding text in many small chunks is therefore linear in its length.
+ *
+ * The Python interpreter is never touched, so this may be used without
+ * holding the GIL.
+ */
+class RecordStream {
+public:
+    /**
+     * \brief Prepare to split text into records
+     * \param sep The non-empty separator between records
+     * \param delimiter The non-empty separator between fields of a record
+     * \param column The field of each record to use as a token, or WHOLE_RECORD
+     * \param skip The number of records at the start of the text to ignore
+     */
+    RecordStream(
+        const std::string_view sep,
+        const std::string_view delimiter,
+        const Py_ssize_t column,
+        const Py_ssize_t skip
+    ) noexcept(false)
+        : m_sep(sep)
+        , m_delimiter(delimiter)
+        , m_column(column)
+        , m_skip(skip)
+        , m_remaining_skip(skip)
+        , m_carry()
+        , m_head()
+        , m_has_head(false)
+        , m_body()
+        , m_tail()
+    { }
+
+    // Cannot copy, because the staged records may refer to the object
+    RecordStream(const RecordStream&) = delete;
+    RecordStream(RecordStream&&) = delete;
+    RecordStream& operator=(const RecordStream&) = delete;
+    ~RecordStream() = default;
+
+    /**
+     * \brief Stage the records that the next chunk of text completes
+     *
+     * The records are referred to where they are in the chunk, so the
+     * chunk must not change until commit() or discard() is called.
+     *
+     * \param chunk The next chunk of text
+     * \return false if the chunk completed no record, in which case it has
+     *         been added to the incomplete record and nothing was staged
+     */
+    bool stage(const std::string_view chunk) noexcept(false)
+    {
+        discard();
+
+        // A separator may start at the end of the incomplete record
+        const std::size_t overlap = m_sep.size() - 1;
+        const std::size_t carried = std::min(overlap, m_carry.size());
+        std::string edge = m_carry.substr(m_carry.size() - carried);
+        edge.append(chunk.substr(0, overlap));
+        const std::size_t found = edge.find(m_sep);
+
+        std::size_t body_start = 0;
+        if (found < carried) {
+            const std::size_t head_size = m_carry.size() - carried + found;
+            m_head.assign(m_carry, 0, head_size);
+            body_start = found + m_sep.size() - carried;
+        } else {
+            const std::size_t end = chunk.find(m_sep);
+            if (end == std::string_view::npos) {
+                m_carry.append(chunk);
+                return false;
+            }
+            m_head.assign(m_carry);
+            m_head.append(chunk.substr(0, end));
+            body_start = end + m_sep.size();
+        }
+        m_has_head = true;
+
+        // The incomplete record at the end is not staged, only remembered
+        std::size_t tail_start = body_start;
+        const std::size_t last = chunk.rfind(m_sep);
+        if (last != std::string_view::npos && last >= body_start) {
+            tail_start = last + m_sep.size();
+        }
+        m_body = chunk.substr(body_start, tail_start - body_start);
+        m_tail = chunk.substr(tail_start);
+        return true;
+    }
+
+    /// Stage the incomplete record at the end of the text, if there is one
+    void stage_end() noexcept(false)
+    {
+        discard();
+        if (!m_carry.empty()) {
+            m_head.assign(m_carry);
+            m_has_head = true;
+        }
+    }
+
+    /// The tokens of the staged records, excluding records still to be skipped
+    Tokenizer tokens() const noexcept
+    {
+        return Tokenizer(
+            m_body, m_sep, m_delimiter, m_column, m_remaining_skip,
+            m_has_head ? std::optional<std::string_view>(m_head) : std::nullopt
+        );
+    }
+
+    /// Consume the staged records, once they have been parsed
+    void commit() noexcept(false)
+    {
+        m_remaining_skip -= tokens().skipped();
+        m_carry.assign(m_tail);
+        m_head.clear();
+        m_has_head = false;
+        m_body = m_tail = std::string_view();
+    }
+
+    /// Forget the staged records, so they can be given again
+    void discard() noexcept
+    {
+        m_head.clear();
+        m_has_head = false;
+        m_body = m_tail = std::string_view();
+    }
+
+    /// Forget all text, so that the next chunk is the start of new text
+    void reset() noexcept
+    {
+        discard();
+        m_carry.clear();
+        m_remaining_skip = m_skip;
+    }
+
+private:
+    /// The separator between records
+    std::string m_sep;
+
+    /// The separator between fields
+    std::string m_delimiter;
+
+    /// The field of each record to use as a token
+    Py_ssize_t m_column;
+
+    /// The number of records at the start of the text to ignore
+    Py_ssize_t m_skip;
+
+    /// The number of records still to be ignored
+    Py_ssize_t m_remaining_skip;
+
+    /// The incomplete record at the end of the text so far
+    std::string m_carry;
+
+    /// The first staged record, made from the incomplete record and the chunk
+    std::string m_head;
+
+    /// Whether or not there is a staged first record
+    bool m_has_head;
+
+    /// The other complete records of the staged chunk
+    std::string_view m_body;
+
+    /// The incomplete record at the end of the staged chunk
+    std::string_view m_tail;
+};
+
+/**
+ * \class DelimitedReader
+ * \brief Read the fields of delimited text such as CSV or TSV
+ *
+ * Records are separated by newlines, and fields by a single character.
+ * A field that starts with the quote character ends at the matching
+ * quote, so it may contain the delimiter or newlines, and a doubled quote
+ * character within it stands for a single one. Blank lines are skipped,
+ * and a carriage return ending a record is not part of its last field.
+ *
+ * The Python interpreter is never touched, so reading may be done
+ * without holding the GIL.
+ */
+class DelimitedReader {
+public:
+    /// Value of the quote character to indicate fields are never quoted
+    static constexpr int NO_QUOTE = -1;
+
+    /// A field of a record
+    struct Field {
+        /// The text of the field, excluding any surrounding quotes
+        std::string_view text {};
+
+        /// Whether or not the field was quoted
+        bool quoted = false;
+    };
+
+    /**
+     * \brief Prepare to read delimited text
+     * \param text The text to read - it must outlive this object
+     * \param delimiter The separator between fields of a record
+     * \param quote The quote character, or NO_QUOTE
+     */
+    DelimitedReader(
+        const std::string_view text, const char delimiter, const int quote = NO_QUOTE
+    ) noexcept
+        : m_text(text)
+        , m_delimiter(delimiter)
+        , m_quoting(quote != NO_QUOTE)
+        , m_quote(static_cast<char>(quote))
+        , m_pos(0)
+        , m_in_record(false)
+    { }
+
+    // Default copy/assignment and destructor
+    DelimitedReader(const DelimitedReader&) = default;
+    DelimitedReader(DelimitedReader&&) = default;
+    DelimitedReader& operator=(const DelimitedReader&) = default;
+    ~DelimitedReader() = default;
+
+    /// The number of records after the current one
+    Py_ssize_t count() const noexcept
+    {
+        DelimitedReader reader(*this);
+        Field field;
+        while (reader.next_field(field)) { }
+        const std::string_view rest = m_text.substr(reader.m_pos);
+
+        // Without quotes, each non-blank line is a record
+        if (!m_quoting || rest.find(m_quote) == std::string_view::npos) {
+            Py_ssize_t total = 0;
+            for (std::size_t start = 0; start < rest.size();) {
+                const std::size_t end = std::min(rest.find('\n', start), rest.size());
+                total += !is_blank(rest.substr(start, end - start));
+                start = end + 1;
+            }
+            return total;
+        }
+
+        // Otherwise newlines may be within quotes, so the fields must be read
+        const int quote = static_cast<unsigned char>(m_quote);
+        reader = DelimitedReader(rest, m_delimiter, quote);
+        Py_ssize_t total = 0;
+        while (reader.next_record()) {
+            total += 1;
+        }
+        return total;
+    }
+
+    /**
+     * \brief Move to the start of the next record
+     *
+     * Any fields of the current record that have not been read are skipped.
+     *
+     * \return false if there are no more records
+     */
+    bool next_record() noexcept
+    {
+        Field field;
+        while (next_field(field)) { }
+
+        // Skip blank lines, i.e. those containing nothing but carriage returns
+        while (m_pos < m_text.size()) {
+            std::size_t pos = m_pos;
+            while (pos < m_text.size() && m_text[pos] == '\r') {
+                pos += 1;
+            }
+            if (pos < m_text.size() && m_text[pos] != '\n') {
+                break;
+            }
+            m_pos = pos + 1;
+        }
+        m_in_record = m_pos < m_text.size();
+        return m_in_record;
+    }
+
+    /**
+     * \brief Read the next field of the current record
+     * \param field Where to store the field
+     * \return false if there are no more fields in the record
+     */
+    bool next_field(Field& field) noexcept
+    {
+        if (!m_in_record) {
+            return false;
+        }
+
+        const std::size_t size = m_text.size();
+        std::size_t pos = m_pos;
+        if (m_quoting && pos < size && m_text[pos] == m_quote) {
+            const std::size_t end = closing_quote(pos + 1);
+            field = { m_text.substr(pos + 1, end - pos - 1), true };
+
+            // Anything between the closing quote and the delimiter is ignored
+            pos = std::min(end + 1, size);
+            while (pos < size && m_text[pos] != m_delimiter && m_text[pos] != '\n') {
+                pos += 1;
+            }
+        } else {
+            const std::size_t start = pos;
+            while (pos < size && m_text[pos] != m_delimiter && m_text[pos] != '\n') {
+                pos += 1;
+            }
+            std::size_t stop = pos;
+            if (stop > start && m_text[stop - 1] == '\r'
+                && (pos == size || m_text[pos] == '\n')) {
+                stop -= 1;
+            }
+            field = { m_text.substr(start, stop - start), false };
+        }
+
+        // The record ends with the end of the line
+        m_in_record = pos < size && m_text[pos] == m_delimiter;
+        m_pos = std::min(pos + 1, size);
+        return true;
+    }
+
+    /**
+     * \brief The text of a field with doubled quote characters made single
+     * \param field The field to unescape
+     */
+    std::string unescape(const Field& field) const noexcept(false)
+    {
+        std::string result(field.text);
+        if (field.quoted) {
+            const std::string doubled(2, m_quote);
+            for (std::size_t pos = result.find(doubled); pos != std::string::npos;
+                 pos = result.find(doubled, pos + 1)) {
+                result.erase(pos, 1);
+            }
+        }
+        return result;
+    }
+
+private:
+    /// The text to read
+    std::string_view m_text;
+
+    /// The separator between fields
+    char m_delimiter;
+
+    /// Whether or not fields may be quoted
+    bool m_quoting;
+
+    /// The quote character
+    char m_quote;
+
+    /// The start of the next field or record
+    std::size_t m_pos;
+
+    /// Whether or not more fields of the current record remain
+    bool m_in_record;
+
+private:
+    /// Whether or not a line contains nothing but carriage returns
+    static bool is_blank(const std::string_view line) noexcept
+    {
+        return line.find_first_not_of('\r') == std::string_view::npos;
+    }
+
+    /// Find the quote that closes a field, or the end of the text if none does
+    std::size_t closing_quote(std::size_t pos) const noexcept
+    {
+        while (true) {
+            pos = m_text.find(m_quote, pos);
+            if (pos == std::string_view::npos) {
+                return m_text.size();
+            } else if (pos + 1 < m_text.size() && m_text[pos + 1] == m_quote) {
+                pos += 2;
+            } else {
+                return pos;
+            }
+        }
+    }
+};
+
+/**
+ * \class FixedWidthReader
+ * \brief Read the records of text in which fields are at fixed positions
+ *
+ * Records are either lines, or have a fixed length (i.e. start at a fixed
+ * stride, with any line endings counted in the length). For lines, blank
+ * lines are skipped, and a carriage return ending a line is not part of
+ * its record. For a fixed length, the last record may be shorter.
+ *
+ * The Python interpreter is never touched, so reading may be done
+ * without holding the GIL.
+ */
+class FixedWidthReader {
+public:
+    /// Value of the record length to indicate records are lines
+    static constexpr std::size_t LINES = 0;
+
+    /**
+     * \brief Prepare to read fixed-width text
+     * \param text The text to read - it must outlive this object
+     * \param length The length of each record, or LINES
+     */
+    explicit FixedWidthReader(
+        const std::string_view text, const std::size_t length = LINES
+    ) noexcept
+        : m_text(text)
+        , m_length(length)
+        , m_pos(0)
+    { }
+
+    // Default copy/assignment and destructor
+    FixedWidthReader(const FixedWidthReader&) = default;
+    FixedWidthReader(FixedWidthReader&&) = default;
+    FixedWidthReader& operator=(const FixedWidthReader&) = default;
+    ~FixedWidthReader() = default;
+
+    /// The number of records that remain
+    Py_ssize_t count() const noexcept
+    {
+        const std::size_t rest = m_text.size() - m_pos;
+        if (m_length != LINES) {
+            return static_cast<Py_ssize_t>((rest + m_length - 1) / m_length);
+        }
+        Py_ssize_t total = 0;
+        std::string_view record;
+        for (FixedWidthReader reader(*this); reader.next(record);) {
+            total += 1;
+        }
+        return total;
+    }
+
+    /**
+     * \brief Obtain the next record
+     * \param record Where to store the record
+     * \return false if there are no more records
+     */
+    bool next(std::string_view& record) noexcept
+    {
+        if (m_length != LINES) {
+            if (m_pos >= m_text.size()) {
+                return false;
+            }
+            record = m_text.substr(m_pos, m_length);
+            m_pos += record.size();
+            return true;
+        }
+
+        while (m_pos < m_text.size()) {
+            const std::size_t end = std::min(m_text.find('\n', m_pos), m_text.size());
+            record = m_text.substr(m_pos, end - m_pos);
+            m_pos = end + 1;
+            if (!record.empty() && record.back() == '\r') {
+                record.remove_suffix(1);
+            }
+            if (!record.empty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    /// The text to read
+    std::string_view m_text;
+
+    /// The length of each record, or LINES
+    std::size_t m_length;
+
+    /// The start of the next record, or past the end of the text if none remain
+    std::size_t m_pos;
+};
+
+/**
+ * \class JsonArrayReader
+ * \brief Read the numbers of a JSON array of numbers
+ *
+ * The array may contain numbers and nulls, or else arrays (all of the same
+ * length) of numbers and nulls, i.e. it has one or two dimensions. The text
+ * of each number is checked against the JSON number grammar, but not parsed.
+ *
+ * The Python interpreter is never touched, so reading may be done
+ * without holding the GIL.
+ */
+class JsonArrayReader {
+public:
+    /**
+     * \brief Prepare to read a JSON array
+     * \param text The text to read - it must outlive this object
+     */
+    explicit JsonArrayReader(const std::string_view text) noexcept
+        : m_text(text)
+        , m_pos(0)
+        , m_rows(0)
+        , m_columns(0)
+        , m_nested(false)
+        , m_error(nullptr)
+    { }
+
+    // Default copy/assignment and destructor
+    JsonArrayReader(const JsonArrayReader&) = default;
+    JsonArrayReader(JsonArrayReader&&) = default;
+    JsonArrayReader& operator=(const JsonArrayReader&) = default;
+    ~JsonArrayReader() = default;
+
+    /**
+     * \brief Read each value of the array
+     *
+     * After reading, the shape of the array is known, or else the reason
+     * why the text is not a valid array and the position where that was found.
+     *
+     * \param visit Function accepting the row and column of a value, its text,
+     *              and whether or not it is null
+     * \return false if the text is not a valid array
+     */
+    template <typename Visitor>
+    bool read(Visitor visit) noexcept(false)
+    {
+        m_pos = 0;
+        m_rows = 0;
+        m_columns = 0;
+        m_nested = false;
+        m_error = nullptr;
+        if (!expect('[', "expected '['")) {
+            return false;
+        }
+        if (!peek(']')) {
+            do {
+                if (peek('[')) {
+                    if (m_rows > 0 && !m_nested) {
+                        return fail("expected a number or null, not an array");
+                    }
+                    m_nested = true;
+                    if (!read_row(visit)) {
+                        return false;
+                    }
+                } else {
+                    if (m_nested) {
+                        return fail("expected an array, not a number or null");
+                    }
+                    if (!read_value(visit, m_rows, 0)) {
+                        return false;
+                    }
+                }
+                m_rows += 1;
+            } while (next_item());
+        }
+        if (!expect(']', "expected ',' or ']'")) {
+            return false;
+        }
+        skip_whitespace();
+        return m_pos == m_text.size() || fail("unexpected text after the array");
+    }
+
+    /// The number of values or nested arrays of the array that was read
+    Py_ssize_t rows() const noexcept { return m_rows; }
+
+    /// The length of the nested arrays of the array that was read, if any
+    Py_ssize_t columns() const noexcept { return m_columns; }
+
+    /// Whether or not the array that was read contains arrays
+    bool nested() const noexcept { return m_nested; }
+
+    /// Why the text is not a valid array
+    const char* error() const noexcept { return m_error; }
+
+    /// Where the text was found to not be a valid array
+    Py_ssize_t position() const noexcept { return static_cast<Py_ssize_t>(m_pos); }
+
+private:
+    /// The text to read
+    std::string_view m_text;
+
+    /// The position of the next character to read
+    std::size_t m_pos;
+
+    /// The number of values or nested arrays
+    Py_ssize_t m_rows;
+
+    /// The length of each nested array
+    Py_ssize_t m_columns;
+
+    /// Whether or not the array contains arrays
+    bool m_nested;
+
+    /// Why the text is not a valid array, or nullptr if it is
+    const char* m_error;
+
+private:
+    /// Read the values of a nested array
+    template <typename Visitor>
+    bool read_row(Visitor& visit) noexcept(false)
+    {
+        m_pos += 1;
+        Py_ssize_t column = 0;
+        if (!peek(']')) {
+            do {
+                if (peek('[')) {
+                    return fail("arrays may only be nested one level");
+                }
+                if (!read_value(visit, m_rows, column)) {
+                    return false;
+                }
+                column += 1;
+            } while (next_item());
+        }
+        if (!expect(']', "expected ',' or ']'")) {
+            return false;
+        }
+        if (m_rows == 0) {
+            m_columns = column;
+        } else if (column != m_columns) {
+            return fail("nested arrays must all have the same length");
+        }
+        return true;
+    }
+
+    /// Read a number or null
+    template <typename Visitor>
+    bool read_value(Visitor& visit, const Py_ssize_t row, const Py_ssize_t column)
+        noexcept(false)
+    {
+        constexpr std::string_view null = "null";
+        const std::size_t start = m_pos;
+        if (m_text.substr(start, null.size()) == null) {
+            m_pos += null.size();
+            visit(row, column, m_text.substr(start, null.size()), true);
+            return true;
+        }
+
+        // -?(0|[1-9][0-9]*)(\.[0-9]+)?([eE][+-]?[0-9]+)?
+        consume('-');
+        if (!consume('0') && digits() == 0) {
+            return fail("expected a number, null or '['");
+        }
+        if (consume('.') && digits() == 0) {
+            return fail("expected a digit after the decimal point");
+        }
+        if (consume('e') || consume('E')) {
+            if (!consume('+')) {
+                consume('-');
+            }
+            if (digits() == 0) {
+                return fail("expected a digit in the exponent");
+            }
+        }
+        visit(row, column, m_text.substr(start, m_pos - start), false);
+        return true;
+    }
+
+    /// Move past a separator between items, returning false if there is none
+    bool next_item() noexcept
+    {
+        skip_whitespace();
+        if (m_pos < m_text.size() && m_text[m_pos] == ',') {
+            m_pos += 1;
+            skip_whitespace();
+            return true;
+        }
+        return false;
+    }
+
+    /// Whether or not the next character after any whitespace is the given one
+    bool peek(const char c) noexcept
+    {
+        skip_whitespace();
+        return m_pos < m_text.size() && m_text[m_pos] == c;
+    }
+
+    /// Move past the next character after any whitespace, which must be the given one
+    bool expect(const char c, const char* error) noexcept
+    {
+        if (!peek(c)) {
+            return fail(error);
+        }
+        m_pos += 1;
+        return true;
+    }
+
+    /// Move past the next character if it is the given one
+    bool consume(const char c) noexcept
+    {
+        if (m_pos < m_text.size() && m_text[m_pos] == c) {
+            m_pos += 1;
+            return true;
+        }
+        return false;
+    }
+
+    /// Move past any decimal digits, returning how many there were
+    std::size_t digits() noexcept
+    {
+        const std::size_t start = m_pos;
+        std::size_t pos = start;
+        while (pos < m_text.size() && m_text[pos] >= '0' && m_text[pos] <= '9') {
+            pos += 1;
+        }
+        m_pos = pos;
+        return pos - start;
+    }
+
+    /// Move past JSON whitespace
+    void skip_whitespace() noexcept
+    {
+        while (m_pos < m_text.size() && is_whitespace(m_text[m_pos])) {
+            m_pos += 1;
+        }
+    }
+
+    /// Whether or not a character is JSON whitespace
+    static bool is_whitespace(const char c) noexcept
+    {
+        return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+    }
+
+    /// Record why the text is not a valid array
+    bool fail(const char* error) noexcept
+    {
+        m_error = error;
+        return false;
+    }
+};
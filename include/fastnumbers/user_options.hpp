@@ -168,4 +168,138 @@ private:
 
     /// Whether or not a unicode character is allowed
     bool m_unicode_allowed;
-};
\ No newline at end of file
+};
+
+/// Namespace for the options that can be fixed at compile time, as mask bits
+struct FixedOption {
+    /// No options are fixed
+    static constexpr unsigned NONE = 0U;
+
+    /// The default base (10) was given, so unicode characters are allowed
+    static constexpr unsigned DEFAULT_BASE = 1U << 0;
+
+    /// Underscores are not allowed
+    static constexpr unsigned NO_UNDERSCORES = 1U << 1;
+
+    /// Int-like floats are not coerced to ints
+    static constexpr unsigned NO_COERCE = 1U << 2;
+
+    /// Int-like floats are coerced to ints
+    static constexpr unsigned COERCE = 1U << 3;
+};
+
+/**
+ * \class FixedOptions
+ * \brief UserOptions where some of the values are known at compile time
+ *
+ * This has the same accessors as UserOptions, but the options named in the
+ * Fixed mask return constants. Code templated on the options type therefore
+ * has no branches on those options once it is compiled.
+ *
+ * The NaN and infinity allowances are deliberately not available here.
+ * They are only read by Implementation::resolve_types(), which serves the
+ * check functions one input at a time; the batch paths (map and try_array)
+ * never read them, and handle NaN and infinity through the resolver or
+ * the replacement values of the extractor instead. Leaving the accessors
+ * out means a batch path that started to depend on them would not compile
+ * until they were given a mask bit.
+ */
+template <unsigned Fixed>
+class FixedOptions final {
+public:
+    /// Construct from options that must agree with those that are fixed
+    explicit FixedOptions(const UserOptions& options) noexcept
+        : m_options(options)
+    { }
+    FixedOptions(const FixedOptions&) = default;
+    FixedOptions(FixedOptions&&) = default;
+    FixedOptions& operator=(const FixedOptions&) = default;
+    ~FixedOptions() = default;
+
+    /// Determine if the given options agree with those that are fixed
+    static bool matches(const UserOptions& options) noexcept
+    {
+        return (!(Fixed & FixedOption::DEFAULT_BASE)
+                || (options.is_default_base() && options.allow_unicode()))
+            && (!(Fixed & FixedOption::NO_UNDERSCORES) || !options.allow_underscores())
+            && (!(Fixed & FixedOption::NO_COERCE) || !options.allow_coerce())
+            && (!(Fixed & FixedOption::COERCE) || options.allow_coerce());
+    }
+
+    /// Get the stored base
+    int get_base() const noexcept
+    {
+        if constexpr (bool(Fixed & FixedOption::DEFAULT_BASE)) {
+            return 10;
+        }
+        return m_options.get_base();
+    }
+
+    /// Was the default base given?
+    bool is_default_base() const noexcept
+    {
+        if constexpr (bool(Fixed & FixedOption::DEFAULT_BASE)) {
+            return true;
+        }
+        return m_options.is_default_base();
+    }
+
+    /// Are underscores allowed?
+    bool allow_underscores() const noexcept
+    {
+        if constexpr (bool(Fixed & FixedOption::NO_UNDERSCORES)) {
+            return false;
+        }
+        return m_options.allow_underscores();
+    }
+
+    /// Indicate if we are allowing coersion of floats to ints
+    bool allow_coerce() const noexcept
+    {
+        if constexpr (bool(Fixed & FixedOption::COERCE)) {
+            return true;
+        } else if constexpr (bool(Fixed & FixedOption::NO_COERCE)) {
+            return false;
+        }
+        return m_options.allow_coerce();
+    }
+
+    /// Indicate if we allow non-ASCII unicode characters as input
+    bool allow_unicode() const noexcept
+    {
+        if constexpr (bool(Fixed & FixedOption::DEFAULT_BASE)) {
+            return true;
+        }
+        return m_options.allow_unicode();
+    }
+
+private:
+    /// The run-time options, used for anything that is not fixed
+    UserOptions m_options;
+};
+
+/**
+ * \brief Call a function with options that are fixed at compile time if possible
+ *
+ * The options are compared once against the few combinations that are
+ * used most often (the defaults of the conversion functions), and the
+ * function is given a FixedOptions for the first one that matches.
+ * If none match, all options are read at run time.
+ *
+ * \param options The run-time options
+ * \param func Function that can accept any FixedOptions specialization
+ * \return The return value of func
+ */
+template <typename Function>
+decltype(auto) with_fixed_options(const UserOptions& options, Function func)
+{
+    constexpr unsigned base = FixedOption::DEFAULT_BASE | FixedOption::NO_UNDERSCORES;
+    using Default = FixedOptions<base | FixedOption::NO_COERCE>;
+    using DefaultCoerce = FixedOptions<base | FixedOption::COERCE>;
+    if (Default::matches(options)) {
+        return func(Default(options));
+    } else if (DefaultCoerce::matches(options)) {
+        return func(DefaultCoerce(options));
+    }
+    return func(FixedOptions<FixedOption::NONE>(options));
+}
@@ -3,6 +3,7 @@
 import copy
 import gc
 import math
+import random
 import re
 import sys
 import timeit
@@ -86,7 +87,8 @@ class Timer(object):
             row = []
             for func, setup, _, iterable in self.functions:
                 if iterable:
-                    setup += f"; iterable = [{value!r}] * 50"
+                    data = value if isinstance(value, list) else [value] * 50
+                    setup += f"; iterable = {data!r}"
                     call = f"{func}(iterable)"
                 else:
                     call = f"{func}({value!r})"
@@ -132,6 +134,24 @@ class Timer(object):
         return self.mean(result), self.stddev(result)
 
 
+def with_invalid(fraction, size=50):
+    """Return a list of float strings where a fraction are not numbers."""
+    n_invalid = round(fraction * size)
+    values = ["not_a_number"] * n_invalid + ["-41053.543034e34"] * (size - n_invalid)
+    random.Random(0).shuffle(values)
+    return values
+
+
+class InvalidFractionTimer(Timer):
+    """Time functions against 50 element lists with some invalid elements."""
+
+    THINGS_TO_TIME = (
+        (with_invalid(0.0), "0% Invalid"),
+        (with_invalid(0.1), "10% Invalid"),
+        (with_invalid(0.9), "90% Invalid"),
+    )
+
+
 class Table(list):
     """List of strings that can be made into a Markdown table."""
 
@@ -382,6 +402,26 @@ def fn_into_array(iterable, func=fastnumbers.try_array, out=output):
     func(iterable, out)
 
 
+def fn_map_on_fail_callable(iterable, func=fastnumbers.try_float):
+    return func(iterable, map=list, on_fail=len)
+
+
+def fn_into_array_on_fail_callable(iterable, func=fastnumbers.try_array, out=output):
+    func(iterable, out, on_fail=len)
+
+
+def lengths(iterable):
+    return list(map(len, iterable))
+
+
+def fn_map_on_fail_batched(iterable, func=fastnumbers.try_float):
+    return func(iterable, map=list, on_fail=lengths, batch_callables=True)
+
+
+def fn_into_array_on_fail_batched(iterable, func=fastnumbers.try_array, out=output):
+    func(iterable, out, on_fail=lengths, batch_callables=True)
+
+
 print(sys.version_info)
 print()
 
@@ -405,6 +445,11 @@ timer = Timer("Timing comparison of `float` functions with error handling")
 timer.add_function("float_try", "try/except", "from __main__ import float_try")
 timer.add_function("float_re", "regex", "from __main__ import float_re")
 timer.add_function("try_float", "fastnumbers", "from fastnumbers import try_float")
+timer.add_function(
+    "to_float",
+    "fastnumbers Converter",
+    "from fastnumbers import Converter; to_float = Converter('float')",
+)
 timer.time_functions()
 
 timer = Timer(
@@ -487,6 +532,12 @@ timer.add_function(
     "from __main__ import fn_map_option",
     iterable=True,
 )
+timer.add_function(
+    "to_float.list",
+    "Converter('float').list(iterable)",
+    "from fastnumbers import Converter; to_float = Converter('float')",
+    iterable=True,
+)
 timer.time_functions()
 
 timer = Timer(
@@ -512,3 +563,39 @@ timer.add_function(
     iterable=True,
 )
 timer.time_functions()
+
+timer = InvalidFractionTimer(
+    "Timing comparison of error handling for a 50 element list "
+    "with a fraction of invalid elements"
+)
+timer.add_function(
+    "fn_map_option",
+    "try_float(iterable, map=list)",
+    "from __main__ import fn_map_option",
+    iterable=True,
+)
+timer.add_function(
+    "fn_map_on_fail_callable",
+    "try_float(iterable, map=list, on_fail=len)",
+    "from __main__ import fn_map_on_fail_callable",
+    iterable=True,
+)
+timer.add_function(
+    "fn_into_array_on_fail_callable",
+    "try_array(iterable, output, on_fail=len)",
+    "from __main__ import fn_into_array_on_fail_callable",
+    iterable=True,
+)
+timer.add_function(
+    "fn_map_on_fail_batched",
+    "try_float(iterable, map=list, on_fail=lengths, batch_callables=True)",
+    "from __main__ import fn_map_on_fail_batched",
+    iterable=True,
+)
+timer.add_function(
+    "fn_into_array_on_fail_batched",
+    "try_array(iterable, output, on_fail=lengths, batch_callables=True)",
+    "from __main__ import fn_into_array_on_fail_batched",
+    iterable=True,
+)
+timer.time_functions()
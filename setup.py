@@ -4,11 +4,13 @@
 import glob
 import os
 import sys
+import tempfile
 
 from setuptools import Extension, find_packages, setup
 
 
 # Compilation arguments are platform-dependent
+link_args = ["-lm"]
 if sys.platform == "win32":
     compile_args = [
         "/std:c++17",
@@ -25,7 +27,9 @@ else:
         "-Wall",
         "-Weffc++",
         "-Wpedantic",
+        "-pthread",  # Compressed input is decompressed in a worker thread
     ]
+    link_args.append("-pthread")
     if sys.platform == "darwin":
         compile_args.append("-mmacosx-version-min=10.13")
     if "FN_DEBUG" in os.environ or "FN_COV" in os.environ:
@@ -33,13 +37,48 @@ else:
         compile_args.append("-g")
 
 
+def has_zlib():
+    """Whether or not a program using zlib can be compiled and linked."""
+    from distutils.ccompiler import new_compiler
+    from distutils.errors import CCompilerError, DistutilsError
+    from distutils.sysconfig import customize_compiler
+
+    compiler = new_compiler()
+    customize_compiler(compiler)
+    with tempfile.TemporaryDirectory() as tmp:
+        source = os.path.join(tmp, "zlib_check.c")
+        with open(source, "w") as fp:
+            fp.write("#include <zlib.h>\nint main(void) { return !zlibVersion(); }\n")
+        try:
+            objects = compiler.compile([source], output_dir=tmp)
+            compiler.link_executable(
+                objects, "zlib_check", output_dir=tmp, libraries=["z"]
+            )
+        except (CCompilerError, DistutilsError):
+            return False
+    return True
+
+
+# Compressed input is decompressed natively if zlib is available.
+# Otherwise, fastnumbers raises an error when asked to decompress.
+if has_zlib():
+    libraries = ["z"]
+    define_macros = [("FASTNUMBERS_ZLIB", None)]
+else:
+    libraries = []
+    define_macros = []
+    print("zlib was not found, so fastnumbers cannot decompress input")
+
+
 ext = [
     Extension(
         "fastnumbers.fastnumbers",
         sorted(glob.glob("src/cpp/*.cpp")),
         include_dirs=[os.path.abspath(os.path.join("include"))],
+        define_macros=define_macros,
+        libraries=libraries,
         extra_compile_args=compile_args,
-        extra_link_args=["-lm"],
+        extra_link_args=link_args,
     )
 ]
 
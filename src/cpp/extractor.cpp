@@ -10,7 +10,11 @@
 
 // Forward declarations
 AnyParser parse_unicode_to_char(
-    PyObject* obj, Buffer& char_buffer, const UserOptions& options
+    const unsigned kind,
+    const void* data,
+    Py_ssize_t len,
+    Buffer& char_buffer,
+    const UserOptions& options
 ) noexcept(false);
 
 AnyParser
@@ -41,8 +45,20 @@ extract_parser(PyObject* obj, Buffer& buffer, const UserOptions& options) noexce
             );
         }
 
+        // Ensure input is a valid unicode object.
+        // If true, then not OK for conversion - unclear how this can happen...
+        if (PyUnicode_READY(obj)) {
+            return CharacterParser("", 0, options);
+        }
+
         // Here is the special-case handling for non-ASCII unicode.
-        return parse_unicode_to_char(obj, buffer, options);
+        return parse_unicode_to_char(
+            PyUnicode_KIND(obj),
+            PyUnicode_DATA(obj),
+            PyUnicode_GET_LENGTH(obj),
+            buffer,
+            options
+        );
     } else if (PyBytes_Check(obj)) {
         return CharacterParser(
             PyBytes_AS_STRING(obj),
@@ -84,24 +100,52 @@ extract_parser(PyObject* obj, Buffer& buffer, const UserOptions& options) noexce
     return NumericParser(obj, options);
 }
 
+AnyParser extract_parser(
+    const Py_UCS4* data, const std::size_t len, Buffer& buffer, const UserOptions& options
+) noexcept(false)
+{
+    buffer.reset();
+
+    // If every code point is ASCII, the data can be narrowed directly into
+    // character data - this mirrors the handling of compact ASCII str objects.
+    static constexpr Py_UCS4 ASCII_MAX = 127;
+    std::size_t index = 0;
+    while (index < len && data[index] <= ASCII_MAX) {
+        index += 1;
+    }
+    if (index == len) {
+        buffer.reserve(len);
+        char* narrowed = buffer.start();
+        for (index = 0; index < len; ++index) {
+            narrowed[index] = static_cast<char>(data[index]);
+        }
+        return CharacterParser(narrowed, len, options);
+    }
+
+    // Otherwise, use the special-case handling for non-ASCII unicode.
+    return parse_unicode_to_char(
+        PyUnicode_4BYTE_KIND, data, static_cast<Py_ssize_t>(len), buffer, options
+    );
+}
+
 /// Obtain either a CharacterParser or UnicodeParser from unicode data
 AnyParser parse_unicode_to_char(
-    PyObject* obj, Buffer& char_buffer, const UserOptions& options
+    const unsigned kind,
+    const void* data,
+    Py_ssize_t len,
+    Buffer& char_buffer,
+    const UserOptions& options
 ) noexcept(false)
 {
-    const unsigned kind = PyUnicode_KIND(obj); // Unicode storage format.
-    const void* data = PyUnicode_DATA(obj); // Raw data
-    Py_ssize_t len = PyUnicode_GET_LENGTH(obj);
     Py_ssize_t index = 0;
 
-    // Ensure input is a valid unicode object.
-    // If true, then not OK for conversion - unclear how this can happen...
-    if (PyUnicode_READY(obj)) {
+    // Nothing to do with zero-length data
+    if (len == 0) {
         return CharacterParser("", 0, options);
     }
 
     // Strip whitespace from both ends of the data.
-    while (Py_UNICODE_ISSPACE(PyUnicode_READ(kind, data, index)) && len >= 0) {
+    while (len > 0 && Py_UNICODE_ISSPACE(PyUnicode_READ(kind, data, index))) {
         index += 1;
         len -= 1;
     }
@@ -111,6 +155,11 @@ AnyParser parse_unicode_to_char(
         }
     }
 
+    // Nothing left after stripping whitespace
+    if (len == 0) {
+        return CharacterParser("", 0, options);
+    }
+
     // Remember if it was negative
     const bool negative = PyUnicode_READ(kind, data, index) == '-';
 
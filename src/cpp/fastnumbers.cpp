@@ -1,19 +1,28 @@
 /*
  * This file contains the functions that directly interface with the Python interpreter.
  */
+#include <cstddef>
 #include <exception>
 #include <functional>
 #include <limits>
+#include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <utility>
+#include <vector>
 
 #include <Python.h>
 
 #include "fastnumbers/argparse.hpp"
 #include "fastnumbers/docstrings.hpp"
 #include "fastnumbers/exception.hpp"
+#include "fastnumbers/gil.hpp"
 #include "fastnumbers/implementation.hpp"
+#include "fastnumbers/inflater.hpp"
+#include "fastnumbers/numpy_scalar.hpp"
 #include "fastnumbers/selectors.hpp"
+#include "fastnumbers/string_buffer.hpp"
 #include "fastnumbers/version.hpp"
 
 /**
@@ -125,23 +134,104 @@ static inline PyObject* normalize_map(PyObject* mapval) noexcept
 }
 
 /**
- * \brief Execute the conversion function as a one-off or as an iterable
+ * \brief The Implementation with the default options of a function
+ *
+ * It only needs to be built once - each function has its own configure
+ * function type, and so its own instance of this function.
+ *
+ * \param configure Function that builds the Implementation with the defaults
+ */
+template <typename Function>
+static const Implementation& default_implementation(Function configure) noexcept(false)
+{
+    static const Implementation default_impl = configure();
+    return default_impl;
+}
+
+/**
+ * \brief Convert the input with the default options of a function
+ * \param input The input from Python-land
+ * \param configure Function that builds the Implementation with the defaults
+ * \return The object to return to Python-land
+ */
+template <typename Function>
+static PyObject* convert_with_defaults(PyObject* input, Function configure) noexcept
+{
+    return ExceptionHandler(input).run([&]() -> PyObject* {
+        return default_implementation(configure).convert(input);
+    });
+}
+
+/**
+ * \brief Check the input with the default options of a function
  * \param input The input from Python-land
- * \param convert The function that converts our input to output
+ * \param configure Function that builds the Implementation with the defaults
+ * \return The object to return to Python-land
+ */
+template <typename Function>
+static PyObject* check_with_defaults(PyObject* input, Function configure) noexcept
+{
+    return ExceptionHandler(input).run([&]() -> PyObject* {
+        return default_implementation(configure).check(input);
+    });
+}
+
+/**
+ * \brief Execute the conversion as a one-off or as an iterable
+ *
+ * For an iterable, the options are looked at once so that the conversion
+ * of each element can use options that are fixed at compile time.
+ *
+ * \param input The input from Python-land
+ * \param impl The Implementation that converts our input to output
  * \param map If True or list execute as an iterable, otherwise as a one-off
+ * \param cache If True, an iterable re-uses the results of repeated strings
+ * \param batch If True and map is list, each user callable is called only
+ *              once with a list of all its inputs
  * \return The object to return to Python-land
  */
 static PyObject* choose_execution_scheme(
-    PyObject* input, std::function<PyObject*(PyObject*)> convert, const PyObject* map
+    PyObject* input,
+    Implementation impl,
+    const PyObject* map,
+    const bool cache = false,
+    const bool batch = false
 ) noexcept(false)
 {
-    if (map == Py_True) {
-        return iter_iteration_impl(input, convert);
-    } else if (map == (PyObject*)&PyList_Type) {
-        return list_iteration_impl(input, convert);
-    } else {
-        return convert(input);
+    if (map != Py_True && map != (PyObject*)&PyList_Type) {
+        return impl.convert(input);
+    }
+
+    // An iterator cannot wait until the end to call the user callables
+    DeferredCalls deferred;
+    DeferredCalls* deferred_ptr = nullptr;
+    if (batch && map == (PyObject*)&PyList_Type) {
+        deferred_ptr = &deferred;
+        impl.set_deferred_calls(deferred_ptr);
     }
+
+    // Callables must be called in order, when their results are requested
+    const bool read_ahead = !impl.has_callable_actions();
+    auto iterate = [input, map, deferred_ptr, read_ahead](auto convert) -> PyObject* {
+        if (map == Py_True) {
+            return iter_iteration_impl(input, convert, read_ahead);
+        }
+        return list_iteration_impl(input, std::move(convert), deferred_ptr);
+    };
+    return impl.with_fixed_options([&](const auto& options) -> PyObject* {
+        // Use a lambda instead of the convert function directly so that the
+        // Implementation object (and the cache) stays in memory even if we
+        // return an iterator.
+        if (cache) {
+            auto memo = std::make_shared<InputCache<Payload>>();
+            return iterate([impl, options, memo](PyObject* x) -> PyObject* {
+                return impl.convert(x, options, *memo);
+            });
+        }
+        return iterate([impl, options](PyObject* x) -> PyObject* {
+            return impl.convert(x, options);
+        });
+    });
 }
 
 /**
@@ -159,6 +249,25 @@ static PyObject* fastnumbers_try_real(
     bool coerce = true;
     bool allow_underscores = false;
     PyObject* map = Py_False;
+    bool cache = false;
+    bool batch_callables = false;
+
+    // Define how the options configure the conversion
+    auto configure = [&]() -> Implementation {
+        Implementation impl(UserType::REAL);
+        impl.set_fail_action(on_fail);
+        impl.set_type_error_action(on_type_error);
+        impl.set_inf_action(inf);
+        impl.set_nan_action(nan);
+        impl.set_coerce(coerce);
+        impl.set_underscores_allowed(allow_underscores);
+        return impl;
+    };
+
+    // Fast path for the common case of only giving the input
+    if (len_args == 1 && kwnames == nullptr) {
+        return convert_with_defaults(args[0], configure);
+    }
 
     // Read the function argument
     FN_PREPARE_ARGPARSER;
@@ -172,25 +281,17 @@ static PyObject* fastnumbers_try_real(
                            "$coerce", true, &coerce,
                            "$allow_underscores", true, &allow_underscores,
                            "$map", false, &map,
+                           "$cache", true, &cache,
+                           "$batch_callables", true, &batch_callables,
                            nullptr, false, nullptr
         )) return nullptr;
     // clang-format on
 
     // Execute main logic in an exception handler to convert C++ exceptions
     return ExceptionHandler(input).run([&]() -> PyObject* {
-        // Use a lambda instead of the convert function directly so that the
-        // Implementation object stays in memory even if we return an iterator.
-        Implementation impl(UserType::REAL);
-        impl.set_fail_action(on_fail);
-        impl.set_type_error_action(on_type_error);
-        impl.set_inf_action(inf);
-        impl.set_nan_action(nan);
-        impl.set_coerce(coerce);
-        impl.set_underscores_allowed(allow_underscores);
-        auto convert = [impl = std::move(impl)](PyObject* x) -> PyObject* {
-            return impl.convert(x);
-        };
-        return choose_execution_scheme(input, convert, normalize_map(map));
+        return choose_execution_scheme(
+            input, configure(), normalize_map(map), cache, batch_callables
+        );
     });
 }
 
@@ -208,6 +309,24 @@ static PyObject* fastnumbers_try_float(
     PyObject* on_type_error = Selectors::RAISE;
     bool allow_underscores = false;
     PyObject* map = Py_False;
+    bool cache = false;
+    bool batch_callables = false;
+
+    // Define how the options configure the conversion
+    auto configure = [&]() -> Implementation {
+        Implementation impl(UserType::FLOAT);
+        impl.set_fail_action(on_fail);
+        impl.set_type_error_action(on_type_error);
+        impl.set_inf_action(inf);
+        impl.set_nan_action(nan);
+        impl.set_underscores_allowed(allow_underscores);
+        return impl;
+    };
+
+    // Fast path for the common case of only giving the input
+    if (len_args == 1 && kwnames == nullptr) {
+        return convert_with_defaults(args[0], configure);
+    }
 
     // Read the function arguments
     FN_PREPARE_ARGPARSER;
@@ -220,24 +339,17 @@ static PyObject* fastnumbers_try_float(
                            "$on_type_error", false, &on_type_error,
                            "$allow_underscores", true, &allow_underscores,
                            "$map", false, &map,
+                           "$cache", true, &cache,
+                           "$batch_callables", true, &batch_callables,
                            nullptr, false, nullptr
         )) return nullptr;
     // clang-format on
 
     // Execute main logic in an exception handler to convert C++ exceptions
     return ExceptionHandler(input).run([&]() -> PyObject* {
-        // Use a lambda instead of the convert function directly so that the
-        // Implementation object stays in memory even if we return an iterator.
-        Implementation impl(UserType::FLOAT);
-        impl.set_fail_action(on_fail);
-        impl.set_type_error_action(on_type_error);
-        impl.set_inf_action(inf);
-        impl.set_nan_action(nan);
-        impl.set_underscores_allowed(allow_underscores);
-        auto convert = [impl = std::move(impl)](PyObject* x) -> PyObject* {
-            return impl.convert(x);
-        };
-        return choose_execution_scheme(input, convert, normalize_map(map));
+        return choose_execution_scheme(
+            input, configure(), normalize_map(map), cache, batch_callables
+        );
     });
 }
 
@@ -254,6 +366,23 @@ static PyObject* fastnumbers_try_int(
     PyObject* pybase = nullptr;
     bool allow_underscores = false;
     PyObject* map = Py_False;
+    bool cache = false;
+    bool batch_callables = false;
+
+    // Define how the options configure the conversion
+    auto configure = [&]() -> Implementation {
+        Implementation impl(UserType::INT, assess_integer_base_input(pybase));
+        impl.set_fail_action(on_fail);
+        impl.set_type_error_action(on_type_error);
+        impl.set_unicode_allowed(); // determine from base
+        impl.set_underscores_allowed(allow_underscores);
+        return impl;
+    };
+
+    // Fast path for the common case of only giving the input
+    if (len_args == 1 && kwnames == nullptr) {
+        return convert_with_defaults(args[0], configure);
+    }
 
     // Read the function arguments
     FN_PREPARE_ARGPARSER;
@@ -265,23 +394,17 @@ static PyObject* fastnumbers_try_int(
                            "$base", false, &pybase,
                            "$allow_underscores", true, &allow_underscores,
                            "$map", false, &map,
+                           "$cache", true, &cache,
+                           "$batch_callables", true, &batch_callables,
                            nullptr, false, nullptr
         )) return nullptr;
     // clang-format on
 
     // Execute main logic in an exception handler to convert C++ exceptions
     return ExceptionHandler(input).run([&]() -> PyObject* {
-        // Use a lambda instead of the convert function directly so that the
-        // Implementation object stays in memory even if we return an iterator.
-        Implementation impl(UserType::INT, assess_integer_base_input(pybase));
-        impl.set_fail_action(on_fail);
-        impl.set_type_error_action(on_type_error);
-        impl.set_unicode_allowed(); // determine from base
-        impl.set_underscores_allowed(allow_underscores);
-        auto convert = [impl = std::move(impl)](PyObject* x) -> PyObject* {
-            return impl.convert(x);
-        };
-        return choose_execution_scheme(input, convert, normalize_map(map));
+        return choose_execution_scheme(
+            input, configure(), normalize_map(map), cache, batch_callables
+        );
     });
 }
 
@@ -297,6 +420,22 @@ static PyObject* fastnumbers_try_forceint(
     PyObject* on_type_error = Selectors::RAISE;
     bool allow_underscores = false;
     PyObject* map = Py_False;
+    bool cache = false;
+    bool batch_callables = false;
+
+    // Define how the options configure the conversion
+    auto configure = [&]() -> Implementation {
+        Implementation impl(UserType::FORCEINT);
+        impl.set_fail_action(on_fail);
+        impl.set_type_error_action(on_type_error);
+        impl.set_underscores_allowed(allow_underscores);
+        return impl;
+    };
+
+    // Fast path for the common case of only giving the input
+    if (len_args == 1 && kwnames == nullptr) {
+        return convert_with_defaults(args[0], configure);
+    }
 
     // Read the function arguments
     FN_PREPARE_ARGPARSER;
@@ -307,22 +446,17 @@ static PyObject* fastnumbers_try_forceint(
                            "$on_type_error", false, &on_type_error,
                            "$allow_underscores", true, &allow_underscores,
                            "$map", false, &map,
+                           "$cache", true, &cache,
+                           "$batch_callables", true, &batch_callables,
                            nullptr, false, nullptr
         )) return nullptr;
     // clang-format on
 
     // Execute main logic in an exception handler to convert C++ exceptions
     return ExceptionHandler(input).run([&]() -> PyObject* {
-        // Use a lambda instead of the convert function directly so that the
-        // Implementation object stays in memory even if we return an iterator.
-        Implementation impl(UserType::FORCEINT);
-        impl.set_fail_action(on_fail);
-        impl.set_type_error_action(on_type_error);
-        impl.set_underscores_allowed(allow_underscores);
-        auto convert = [impl = std::move(impl)](PyObject* x) -> PyObject* {
-            return impl.convert(x);
-        };
-        return choose_execution_scheme(input, convert, normalize_map(map));
+        return choose_execution_scheme(
+            input, configure(), normalize_map(map), cache, batch_callables
+        );
     });
 }
 
@@ -342,40 +476,867 @@ static PyObject* fastnumbers_array(
     PyObject* on_type_error = Selectors::RAISE;
     PyObject* pybase = nullptr;
     bool allow_underscores = false;
+    bool cache = false;
+    bool batch_callables = false;
+
+    // Read the function arguments
+    FN_PREPARE_ARGPARSER;
+    // clang-format off
+    if (fn_parse_arguments("array", args, len_args, kwnames,
+                           "input", false,  &input,
+                           "output", false, &output,
+                           "$inf", false, &inf,
+                           "$nan", false, &nan,
+                           "$on_fail", false, &on_fail,
+                           "$on_overflow", false, &on_overflow,
+                           "$on_type_error", false, &on_type_error,
+                           "$base", false, &pybase,
+                           "$allow_underscores", true, &allow_underscores,
+                           "$cache", true, &cache,
+                           "$batch_callables", true, &batch_callables,
+                           nullptr, false, nullptr
+        )) return nullptr;
+    // clang-format on
+
+    // Execute main logic in an exception handler to convert C++ exceptions
+    return ExceptionHandler(input).run([&]() -> PyObject* {
+        array_impl(
+            input,
+            output,
+            inf,
+            nan,
+            on_fail,
+            on_overflow,
+            on_type_error,
+            allow_underscores,
+            cache,
+            batch_callables,
+            assess_integer_base_input(pybase)
+        );
+
+        // No return value, need to return None
+        Py_RETURN_NONE;
+    });
+}
+
+/**
+ * \brief Convert a Python int argument into a non-negative C integer
+ * \param name The name of the argument, for the error message
+ * \param obj The argument, or nullptr or None if not given
+ * \param default_value The value to use if not given
+ * \throws exception_is_set on invalid input
+ */
+static inline Py_ssize_t
+assess_count_input(const char* name, PyObject* obj, const Py_ssize_t default_value)
+    noexcept(false)
+{
+    if (obj == nullptr || obj == Py_None) {
+        return default_value;
+    }
+    const Py_ssize_t value = PyNumber_AsSsize_t(obj, PyExc_OverflowError);
+    if (value == -1 && PyErr_Occurred()) {
+        throw exception_is_set();
+    }
+    if (value < 0) {
+        PyErr_Format(
+            PyExc_ValueError, "'%s' must be non-negative, not %zd", name, value
+        );
+        throw exception_is_set();
+    }
+    return value;
+}
+
+/**
+ * \brief Convert a Python bytes argument into a non-empty separator
+ * \param name The name of the argument, for the error message
+ * \param obj The argument
+ * \throws exception_is_set on invalid input
+ */
+static inline std::string_view assess_separator_input(const char* name, PyObject* obj)
+    noexcept(false)
+{
+    if (!PyBytes_Check(obj)) {
+        PyErr_Format(
+            PyExc_TypeError, "'%s' must be of type bytes, not %.200s", name,
+            Py_TYPE(obj)->tp_name
+        );
+        throw exception_is_set();
+    }
+    if (PyBytes_GET_SIZE(obj) == 0) {
+        PyErr_Format(PyExc_ValueError, "'%s' cannot be empty", name);
+        throw exception_is_set();
+    }
+    return std::string_view(
+        PyBytes_AS_STRING(obj), static_cast<std::size_t>(PyBytes_GET_SIZE(obj))
+    );
+}
+
+/**
+ * \brief Parse the tokens of text into an array, or count them
+ */
+static PyObject* fastnumbers_parse_text(
+    PyObject* self, PyObject* const* args, Py_ssize_t len_args, PyObject* kwnames
+) noexcept
+{
+    PyObject* input = nullptr;
+    PyObject* output = nullptr;
+    PyObject* sep = nullptr;
+    PyObject* delimiter = nullptr;
+    PyObject* usecol = nullptr;
+    PyObject* skip = nullptr;
+    PyObject* inf = Selectors::ALLOWED;
+    PyObject* nan = Selectors::ALLOWED;
+    PyObject* on_fail = Selectors::RAISE;
+    PyObject* on_overflow = Selectors::RAISE;
+    PyObject* pybase = nullptr;
+    bool allow_underscores = false;
+
+    // Read the function arguments
+    FN_PREPARE_ARGPARSER;
+    // clang-format off
+    if (fn_parse_arguments("parse_text", args, len_args, kwnames,
+                           "input", false,  &input,
+                           "output", false, &output,
+                           "$sep", false, &sep,
+                           "$delimiter", false, &delimiter,
+                           "$usecol", false, &usecol,
+                           "$skip", false, &skip,
+                           "$inf", false, &inf,
+                           "$nan", false, &nan,
+                           "$on_fail", false, &on_fail,
+                           "$on_overflow", false, &on_overflow,
+                           "$base", false, &pybase,
+                           "$allow_underscores", true, &allow_underscores,
+                           nullptr, false, nullptr
+        )) return nullptr;
+    // clang-format on
+
+    // Execute main logic in an exception handler to convert C++ exceptions
+    return ExceptionHandler(input).run([&]() -> PyObject* {
+        const std::string_view record_sep = assess_separator_input("sep", sep);
+        const std::string_view field_sep = delimiter == nullptr
+            ? std::string_view()
+            : assess_separator_input("delimiter", delimiter);
+        const Py_ssize_t column
+            = assess_count_input("usecol", usecol, Tokenizer::WHOLE_RECORD);
+        if (column != Tokenizer::WHOLE_RECORD && field_sep.empty()) {
+            throw fastnumbers_exception("'delimiter' must be given with 'usecol'");
+        }
+
+        const BytesView text(input);
+        Tokenizer tokens(
+            text.text(), record_sep, field_sep, column,
+            assess_count_input("skip", skip, 0)
+        );
+
+        // Without an output, the caller wants to know how long it must be
+        if (output == nullptr || output == Py_None) {
+            Py_ssize_t count = 0;
+            {
+                GILReleaser gil;
+                count = tokens.count();
+            }
+            return PyLong_FromSsize_t(count);
+        }
+
+        tokens_array_impl(
+            tokens,
+            output,
+            inf,
+            nan,
+            on_fail,
+            on_overflow,
+            allow_underscores,
+            assess_integer_base_input(pybase)
+        );
+
+        // No return value, need to return None
+        Py_RETURN_NONE;
+    });
+}
+
+/**
+ * \brief Describe the shape of delimited text
+ * \param reader The reader of the text, either within the header record
+ *               or before the first record
+ * \param header Whether or not the reader is within the header record
+ * \return A tuple of the field names (or None without a header), the
+ *         number of fields in the first record, and the number of records
+ */
+static PyObject* describe_delimited(DelimitedReader& reader, const bool header)
+    noexcept(false)
+{
+    // The number of fields is taken from the header, or else the first record
+    DelimitedReader first(reader);
+    if (!header) {
+        first.next_record();
+    }
+    PyObject* names = PyList_New(0);
+    if (names == nullptr) {
+        throw exception_is_set();
+    }
+    Py_ssize_t nfields = 0;
+    DelimitedReader::Field field;
+    while (first.next_field(field)) {
+        nfields += 1;
+        if (header) {
+            const std::string name = first.unescape(field);
+            PyObject* pyname = PyUnicode_DecodeUTF8(
+                name.data(), static_cast<Py_ssize_t>(name.size()), "surrogateescape"
+            );
+            if (pyname == nullptr || PyList_Append(names, pyname) != 0) {
+                Py_XDECREF(pyname);
+                Py_DECREF(names);
+                throw exception_is_set();
+            }
+            Py_DECREF(pyname);
+        }
+    }
+    if (!header) {
+        Py_DECREF(names);
+        Py_INCREF(Py_None);
+        names = Py_None;
+    }
+    return Py_BuildValue("(Nnn)", names, nfields, reader.count());
+}
+
+/**
+ * \brief Convert a Python bytes argument into a single character
+ * \param name The name of the argument, for the error message
+ * \param obj The argument
+ * \throws exception_is_set on invalid input
+ */
+static inline char assess_character_input(const char* name, PyObject* obj)
+    noexcept(false)
+{
+    const std::string_view value = assess_separator_input(name, obj);
+    if (value.size() != 1) {
+        PyErr_Format(PyExc_ValueError, "'%s' must be a single character", name);
+        throw exception_is_set();
+    }
+    return value.front();
+}
+
+/**
+ * \brief Obtain one item of a list argument that has an item for each output
+ * \param name The name of the argument, for the error message
+ * \param obj The argument
+ * \param index The index of the item
+ * \param size The number of outputs
+ * \throws exception_is_set on invalid input
+ */
+static inline PyObject* assess_list_item_input(
+    const char* name, PyObject* obj, const Py_ssize_t index, const Py_ssize_t size
+) noexcept(false)
+{
+    if (!PyList_Check(obj) || PyList_GET_SIZE(obj) != size) {
+        PyErr_Format(PyExc_ValueError, "'%s' must be a list of length %zd", name, size);
+        throw exception_is_set();
+    }
+    return PyList_GET_ITEM(obj, index);
+}
+
+/**
+ * \brief Parse the fields of delimited text into arrays, or describe the text
+ */
+static PyObject* fastnumbers_parse_delimited(
+    PyObject* self, PyObject* const* args, Py_ssize_t len_args, PyObject* kwnames
+) noexcept
+{
+    PyObject* input = nullptr;
+    PyObject* outputs = nullptr;
+    PyObject* sep = nullptr;
+    PyObject* quotechar = nullptr;
+    PyObject* skip = nullptr;
+    bool header = false;
+    PyObject* fields = nullptr;
+    PyObject* masks = nullptr;
+    PyObject* inf = nullptr;
+    PyObject* nan = nullptr;
+    PyObject* on_fail = nullptr;
+    PyObject* on_overflow = nullptr;
+    PyObject* pybase = nullptr;
+    bool allow_underscores = false;
+
+    // Read the function arguments
+    FN_PREPARE_ARGPARSER;
+    // clang-format off
+    if (fn_parse_arguments("parse_delimited", args, len_args, kwnames,
+                           "input", false,  &input,
+                           "outputs", false, &outputs,
+                           "$sep", false, &sep,
+                           "$quotechar", false, &quotechar,
+                           "$skip", false, &skip,
+                           "$header", true, &header,
+                           "$fields", false, &fields,
+                           "$masks", false, &masks,
+                           "$inf", false, &inf,
+                           "$nan", false, &nan,
+                           "$on_fail", false, &on_fail,
+                           "$on_overflow", false, &on_overflow,
+                           "$base", false, &pybase,
+                           "$allow_underscores", true, &allow_underscores,
+                           nullptr, false, nullptr
+        )) return nullptr;
+    // clang-format on
+
+    // Execute main logic in an exception handler to convert C++ exceptions
+    return ExceptionHandler(input).run([&]() -> PyObject* {
+        const char delimiter = assess_character_input("sep", sep);
+        int quote = DelimitedReader::NO_QUOTE;
+        if (quotechar != nullptr && quotechar != Py_None) {
+            quote = static_cast<unsigned char>(
+                assess_character_input("quotechar", quotechar)
+            );
+        }
+
+        // Move past the skipped records and the header
+        const BytesView text(input);
+        DelimitedReader reader(text.text(), delimiter, quote);
+        const Py_ssize_t nskip = assess_count_input("skip", skip, 0);
+        for (Py_ssize_t i = 0; i < nskip && reader.next_record(); ++i) { }
+        if (header) {
+            reader.next_record();
+        }
+
+        // Without outputs, the caller wants to know the shape of the data
+        if (outputs == nullptr || outputs == Py_None) {
+            return describe_delimited(reader, header);
+        }
+
+        if (!PyList_Check(outputs)) {
+            throw fastnumbers_exception("'outputs' must be a list");
+        }
+        const Py_ssize_t size = PyList_GET_SIZE(outputs);
+        const Py_ssize_t rows = reader.count();
+        const int base = assess_integer_base_input(pybase);
+
+        // Create the filler of each output array, indexed by the field it is from
+        std::vector<std::unique_ptr<Column>> owned;
+        std::vector<Column*> columns;
+        for (Py_ssize_t i = 0; i < size; ++i) {
+            const Py_ssize_t field = assess_count_input(
+                "fields", assess_list_item_input("fields", fields, i, size), 0
+            );
+            if (static_cast<std::size_t>(field) >= columns.size()) {
+                columns.resize(static_cast<std::size_t>(field) + 1, nullptr);
+            } else if (columns[static_cast<std::size_t>(field)] != nullptr) {
+                throw fastnumbers_exception("'fields' must not contain duplicates");
+            }
+            const Replacements replacements {
+                assess_list_item_input("inf", inf, i, size),
+                assess_list_item_input("nan", nan, i, size),
+                assess_list_item_input("on_fail", on_fail, i, size),
+                assess_list_item_input("on_overflow", on_overflow, i, size),
+                Selectors::RAISE,
+            };
+            owned.push_back(make_column(
+                PyList_GET_ITEM(outputs, i),
+                assess_list_item_input("masks", masks, i, size),
+                rows,
+                replacements,
+                allow_underscores,
+                base
+            ));
+            columns[static_cast<std::size_t>(field)] = owned.back().get();
+        }
+
+        delimited_impl(reader, rows, columns);
+
+        // No return value, need to return None
+        Py_RETURN_NONE;
+    });
+}
+
+/**
+ * \brief Parse the fields of fixed-width text into arrays, or count the records
+ */
+static PyObject* fastnumbers_parse_fixed(
+    PyObject* self, PyObject* const* args, Py_ssize_t len_args, PyObject* kwnames
+) noexcept
+{
+    PyObject* input = nullptr;
+    PyObject* outputs = nullptr;
+    PyObject* starts = nullptr;
+    PyObject* ends = nullptr;
+    PyObject* record_length = nullptr;
+    PyObject* skip = nullptr;
+    PyObject* masks = nullptr;
+    PyObject* inf = nullptr;
+    PyObject* nan = nullptr;
+    PyObject* on_fail = nullptr;
+    PyObject* on_overflow = nullptr;
+    PyObject* pybase = nullptr;
+    bool allow_underscores = false;
+
+    // Read the function arguments
+    FN_PREPARE_ARGPARSER;
+    // clang-format off
+    if (fn_parse_arguments("parse_fixed", args, len_args, kwnames,
+                           "input", false,  &input,
+                           "outputs", false, &outputs,
+                           "$starts", false, &starts,
+                           "$ends", false, &ends,
+                           "$record_length", false, &record_length,
+                           "$skip", false, &skip,
+                           "$masks", false, &masks,
+                           "$inf", false, &inf,
+                           "$nan", false, &nan,
+                           "$on_fail", false, &on_fail,
+                           "$on_overflow", false, &on_overflow,
+                           "$base", false, &pybase,
+                           "$allow_underscores", true, &allow_underscores,
+                           nullptr, false, nullptr
+        )) return nullptr;
+    // clang-format on
+
+    // Execute main logic in an exception handler to convert C++ exceptions
+    return ExceptionHandler(input).run([&]() -> PyObject* {
+        const Py_ssize_t length = assess_count_input(
+            "record_length", record_length, FixedWidthReader::LINES
+        );
+        if (record_length != nullptr && record_length != Py_None && length == 0) {
+            throw fastnumbers_exception("'record_length' must be positive");
+        }
+
+        // Move past the skipped records
+        const BytesView text(input);
+        FixedWidthReader reader(text.text(), static_cast<std::size_t>(length));
+        const Py_ssize_t nskip = assess_count_input("skip", skip, 0);
+        std::string_view record;
+        for (Py_ssize_t i = 0; i < nskip && reader.next(record); ++i) { }
+
+        Py_ssize_t rows = 0;
+        {
+            GILReleaser gil;
+            rows = reader.count();
+        }
+
+        // Without outputs, the caller wants to know how long they must be
+        if (outputs == nullptr || outputs == Py_None) {
+            return PyLong_FromSsize_t(rows);
+        }
+
+        if (!PyList_Check(outputs)) {
+            throw fastnumbers_exception("'outputs' must be a list");
+        }
+        const Py_ssize_t size = PyList_GET_SIZE(outputs);
+        const int base = assess_integer_base_input(pybase);
+
+        // Create the filler of each output array and locate its field
+        std::vector<std::unique_ptr<Column>> owned;
+        std::vector<Column*> columns;
+        std::vector<std::pair<std::size_t, std::size_t>> ranges;
+        for (Py_ssize_t i = 0; i < size; ++i) {
+            const Py_ssize_t start = assess_count_input(
+                "starts", assess_list_item_input("starts", starts, i, size), 0
+            );
+            const Py_ssize_t end = assess_count_input(
+                "ends", assess_list_item_input("ends", ends, i, size), 0
+            );
+            if (end < start) {
+                PyErr_Format(
+                    PyExc_ValueError,
+                    "The end of a field cannot be before its start, got (%zd, %zd)",
+                    start,
+                    end
+                );
+                throw exception_is_set();
+            }
+            const Replacements replacements {
+                assess_list_item_input("inf", inf, i, size),
+                assess_list_item_input("nan", nan, i, size),
+                assess_list_item_input("on_fail", on_fail, i, size),
+                assess_list_item_input("on_overflow", on_overflow, i, size),
+                Selectors::RAISE,
+            };
+            owned.push_back(make_column(
+                PyList_GET_ITEM(outputs, i),
+                assess_list_item_input("masks", masks, i, size),
+                rows,
+                replacements,
+                allow_underscores,
+                base
+            ));
+            columns.push_back(owned.back().get());
+            ranges.emplace_back(
+                static_cast<std::size_t>(start), static_cast<std::size_t>(end)
+            );
+        }
+
+        fixed_width_impl(reader, rows, ranges, columns);
+
+        // No return value, need to return None
+        Py_RETURN_NONE;
+    });
+}
+
+/**
+ * \brief Convert the fields of rows of Python objects into arrays
+ */
+static PyObject* fastnumbers_rows(
+    PyObject* self, PyObject* const* args, Py_ssize_t len_args, PyObject* kwnames
+) noexcept
+{
+    PyObject* input = nullptr;
+    PyObject* outputs = nullptr;
+    PyObject* masks = nullptr;
+    PyObject* inf = nullptr;
+    PyObject* nan = nullptr;
+    PyObject* on_fail = nullptr;
+    PyObject* on_overflow = nullptr;
+    PyObject* on_type_error = nullptr;
+    PyObject* pybase = nullptr;
+    bool allow_underscores = false;
+
+    // Read the function arguments
+    FN_PREPARE_ARGPARSER;
+    // clang-format off
+    if (fn_parse_arguments("rows", args, len_args, kwnames,
+                           "input", false,  &input,
+                           "outputs", false, &outputs,
+                           "$masks", false, &masks,
+                           "$inf", false, &inf,
+                           "$nan", false, &nan,
+                           "$on_fail", false, &on_fail,
+                           "$on_overflow", false, &on_overflow,
+                           "$on_type_error", false, &on_type_error,
+                           "$base", false, &pybase,
+                           "$allow_underscores", true, &allow_underscores,
+                           nullptr, false, nullptr
+        )) return nullptr;
+    // clang-format on
+
+    // Execute main logic in an exception handler to convert C++ exceptions
+    return ExceptionHandler(input).run([&]() -> PyObject* {
+        if (!PyList_Check(outputs)) {
+            throw fastnumbers_exception("'outputs' must be a list");
+        }
+        const Py_ssize_t rows = PyObject_Length(input);
+        if (rows < 0) {
+            throw exception_is_set();
+        }
+        const Py_ssize_t size = PyList_GET_SIZE(outputs);
+        const int base = assess_integer_base_input(pybase);
+
+        // Create the filler of each output array, in the order of the fields
+        std::vector<std::unique_ptr<Column>> owned;
+        std::vector<Column*> columns;
+        for (Py_ssize_t i = 0; i < size; ++i) {
+            const Replacements replacements {
+                assess_list_item_input("inf", inf, i, size),
+                assess_list_item_input("nan", nan, i, size),
+                assess_list_item_input("on_fail", on_fail, i, size),
+                assess_list_item_input("on_overflow", on_overflow, i, size),
+                assess_list_item_input("on_type_error", on_type_error, i, size),
+            };
+            owned.push_back(make_column(
+                PyList_GET_ITEM(outputs, i),
+                assess_list_item_input("masks", masks, i, size),
+                rows,
+                replacements,
+                allow_underscores,
+                base
+            ));
+            columns.push_back(owned.back().get());
+        }
+
+        rows_impl(input, columns);
+
+        // No return value, need to return None
+        Py_RETURN_NONE;
+    });
+}
+
+/**
+ * \brief Parse the numbers of a JSON array into arrays, or give its shape
+ */
+static PyObject* fastnumbers_parse_json(
+    PyObject* self, PyObject* const* args, Py_ssize_t len_args, PyObject* kwnames
+) noexcept
+{
+    PyObject* input = nullptr;
+    PyObject* outputs = nullptr;
+    PyObject* masks = nullptr;
+    PyObject* null = Selectors::RAISE;
+    PyObject* on_fail = Selectors::RAISE;
+    PyObject* on_overflow = Selectors::RAISE;
+
+    // Read the function arguments
+    FN_PREPARE_ARGPARSER;
+    // clang-format off
+    if (fn_parse_arguments("parse_json", args, len_args, kwnames,
+                           "input", false,  &input,
+                           "outputs", false, &outputs,
+                           "$masks", false, &masks,
+                           "$null", false, &null,
+                           "$on_fail", false, &on_fail,
+                           "$on_overflow", false, &on_overflow,
+                           nullptr, false, nullptr
+        )) return nullptr;
+    // clang-format on
+
+    // Execute main logic in an exception handler to convert C++ exceptions
+    return ExceptionHandler(input).run([&]() -> PyObject* {
+        const BytesView text(input);
+        JsonArrayReader reader(text.text());
+
+        // Without outputs, the caller wants to know the shape of the array
+        if (outputs == nullptr || outputs == Py_None) {
+            bool valid = false;
+            {
+                GILReleaser gil;
+                valid = reader.read([](Py_ssize_t, Py_ssize_t, std::string_view, bool) {
+                });
+            }
+            if (!valid) {
+                PyErr_Format(
+                    PyExc_ValueError,
+                    "Invalid JSON number array at position %zd: %s",
+                    reader.position(),
+                    reader.error()
+                );
+                throw exception_is_set();
+            }
+            if (reader.nested()) {
+                return Py_BuildValue("(nn)", reader.rows(), reader.columns());
+            }
+            return Py_BuildValue("(n)", reader.rows());
+        }
+
+        // The outputs are made from the shape, so the text is not read twice
+        if (!PyList_Check(outputs)) {
+            throw fastnumbers_exception("'outputs' must be a list");
+        }
+        const Py_ssize_t size = PyList_GET_SIZE(outputs);
+        const Py_ssize_t rows
+            = size > 0 ? PyObject_Length(PyList_GET_ITEM(outputs, 0)) : 0;
+        if (rows < 0) {
+            throw exception_is_set();
+        }
+
+        // JSON numbers are always decimal, and null is the only non-number
+        const Replacements replacements {
+            Selectors::ALLOWED, Selectors::ALLOWED, on_fail, on_overflow, null,
+        };
+        std::vector<std::unique_ptr<Column>> owned;
+        std::vector<Column*> columns;
+        for (Py_ssize_t i = 0; i < size; ++i) {
+            owned.push_back(make_column(
+                PyList_GET_ITEM(outputs, i),
+                assess_list_item_input("masks", masks, i, size),
+                rows,
+                replacements,
+                false
+            ));
+            columns.push_back(owned.back().get());
+        }
+
+        json_impl(reader, rows, columns);
+
+        // No return value, need to return None
+        Py_RETURN_NONE;
+    });
+}
+
+/**
+ * \brief Create the natural sort key of an object
+ */
+static PyObject* fastnumbers_natsort_key(
+    PyObject* self, PyObject* const* args, Py_ssize_t len_args, PyObject* kwnames
+) noexcept
+{
+    PyObject* input = nullptr;
+    NaturalOptions options;
+    bool casefold = false;
+
+    // Read the function arguments
+    FN_PREPARE_ARGPARSER;
+    // clang-format off
+    if (fn_parse_arguments("natsort_key", args, len_args, kwnames,
+                           "x", false,  &input,
+                           "$signed", true, &options.is_signed,
+                           "$float", true, &options.real,
+                           "$exp", true, &options.exponent,
+                           "$casefold", true, &casefold,
+                           nullptr, false, nullptr
+        )) return nullptr;
+    // clang-format on
+
+    // Execute main logic in an exception handler to convert C++ exceptions
+    return ExceptionHandler(input).run([&]() -> PyObject* {
+        return natsort_key_impl(input, options, casefold);
+    });
+}
+
+/**
+ * \brief Create the natural sort key of each object of an iterable
+ */
+static PyObject* fastnumbers_natsort_keys(
+    PyObject* self, PyObject* const* args, Py_ssize_t len_args, PyObject* kwnames
+) noexcept
+{
+    PyObject* input = nullptr;
+    NaturalOptions options;
+    bool casefold = false;
+
+    // Read the function arguments
+    FN_PREPARE_ARGPARSER;
+    // clang-format off
+    if (fn_parse_arguments("natsort_keys", args, len_args, kwnames,
+                           "input", false,  &input,
+                           "$signed", true, &options.is_signed,
+                           "$float", true, &options.real,
+                           "$exp", true, &options.exponent,
+                           "$casefold", true, &casefold,
+                           nullptr, false, nullptr
+        )) return nullptr;
+    // clang-format on
+
+    // Execute main logic in an exception handler to convert C++ exceptions
+    return ExceptionHandler(input).run([&]() -> PyObject* {
+        return natsort_keys_impl(input, options, casefold);
+    });
+}
+
+/**
+ * \brief Compare two objects in natural order
+ */
+static PyObject* fastnumbers_natcmp(
+    PyObject* self, PyObject* const* args, Py_ssize_t len_args, PyObject* kwnames
+) noexcept
+{
+    PyObject* a = nullptr;
+    PyObject* b = nullptr;
+    NaturalOptions options;
+    bool casefold = false;
+
+    // Read the function arguments
+    FN_PREPARE_ARGPARSER;
+    // clang-format off
+    if (fn_parse_arguments("natcmp", args, len_args, kwnames,
+                           "a", false,  &a,
+                           "b", false,  &b,
+                           "$signed", true, &options.is_signed,
+                           "$float", true, &options.real,
+                           "$exp", true, &options.exponent,
+                           "$casefold", true, &casefold,
+                           nullptr, false, nullptr
+        )) return nullptr;
+    // clang-format on
+
+    // Execute main logic in an exception handler to convert C++ exceptions
+    return ExceptionHandler(a).run([&]() -> PyObject* {
+        return natcmp_impl(a, b, options, casefold);
+    });
+}
+
+/**
+ * \brief Sort the objects of an iterable in natural order
+ */
+static PyObject* fastnumbers_natsorted(
+    PyObject* self, PyObject* const* args, Py_ssize_t len_args, PyObject* kwnames
+) noexcept
+{
+    PyObject* input = nullptr;
+    PyObject* key = Py_None;
+    bool reverse = false;
+    NaturalOptions options;
+    bool casefold = false;
+
+    // Read the function arguments
+    FN_PREPARE_ARGPARSER;
+    // clang-format off
+    if (fn_parse_arguments("natsorted", args, len_args, kwnames,
+                           "input", false,  &input,
+                           "$key", false, &key,
+                           "$reverse", true, &reverse,
+                           "$signed", true, &options.is_signed,
+                           "$float", true, &options.real,
+                           "$exp", true, &options.exponent,
+                           "$casefold", true, &casefold,
+                           nullptr, false, nullptr
+        )) return nullptr;
+    // clang-format on
+
+    // Execute main logic in an exception handler to convert C++ exceptions
+    return ExceptionHandler(input).run([&]() -> PyObject* {
+        if (key != Py_None && !PyCallable_Check(key)) {
+            PyErr_Format(
+                PyExc_TypeError,
+                "'key' must be callable or None, not %.200s",
+                Py_TYPE(key)->tp_name
+            );
+            throw exception_is_set();
+        }
+        return natsorted_impl(input, key, reverse, options, casefold);
+    });
+}
+
+/**
+ * \brief Determine the type of number to find from its name
+ * \param kind A Python str naming the type, or nullptr for the default
+ * \throws fastnumbers_exception if the kind is not valid
+ */
+static UserType user_type_of_numbers(PyObject* kind) noexcept(false)
+{
+    if (kind == nullptr) {
+        return UserType::REAL;
+    }
+    if (PyUnicode_Check(kind)) {
+        if (PyUnicode_CompareWithASCIIString(kind, "real") == 0) {
+            return UserType::REAL;
+        } else if (PyUnicode_CompareWithASCIIString(kind, "float") == 0) {
+            return UserType::FLOAT;
+        } else if (PyUnicode_CompareWithASCIIString(kind, "int") == 0) {
+            return UserType::INT;
+        }
+    }
+    throw fastnumbers_exception("kind must be one of 'real', 'float', or 'int'");
+}
+
+/**
+ * \brief Find the numbers within text
+ */
+static PyObject* fastnumbers_find_numbers(
+    PyObject* self, PyObject* const* args, Py_ssize_t len_args, PyObject* kwnames
+) noexcept
+{
+    PyObject* input = nullptr;
+    PyObject* kind = nullptr;
+    NaturalOptions options;
+    options.is_signed = true;
+    bool offsets = false;
+    PyObject* map = Py_False;
 
     // Read the function arguments
     FN_PREPARE_ARGPARSER;
     // clang-format off
-    if (fn_parse_arguments("array", args, len_args, kwnames,
-                           "input", false,  &input,
-                           "output", false, &output,
-                           "$inf", false, &inf,
-                           "$nan", false, &nan,
-                           "$on_fail", false, &on_fail,
-                           "$on_overflow", false, &on_overflow,
-                           "$on_type_error", false, &on_type_error,
-                           "$base", false, &pybase,
-                           "$allow_underscores", true, &allow_underscores,
+    if (fn_parse_arguments("find_numbers", args, len_args, kwnames,
+                           "text", false,  &input,
+                           "|kind", false, &kind,
+                           "$signed", true, &options.is_signed,
+                           "$exp", true, &options.exponent,
+                           "$offsets", true, &offsets,
+                           "$map", false, &map,
                            nullptr, false, nullptr
         )) return nullptr;
     // clang-format on
 
     // Execute main logic in an exception handler to convert C++ exceptions
     return ExceptionHandler(input).run([&]() -> PyObject* {
-        array_impl(
-            input,
-            output,
-            inf,
-            nan,
-            on_fail,
-            on_overflow,
-            on_type_error,
-            allow_underscores,
-            assess_integer_base_input(pybase)
-        );
+        const UserType ntype = user_type_of_numbers(kind);
+        auto find = [ntype, options, offsets](PyObject* text) -> PyObject* {
+            return find_numbers_impl(text, ntype, options, offsets);
+        };
 
-        // No return value, need to return None
-        Py_RETURN_NONE;
+        map = normalize_map(map);
+        if (map == Py_True) {
+            return iter_iteration_impl(input, find);
+        } else if (map == (PyObject*)&PyList_Type) {
+            return list_iteration_impl(input, find);
+        }
+        return find(input);
     });
 }
 
@@ -392,6 +1353,21 @@ static PyObject* fastnumbers_check_real(
     PyObject* nan = Selectors::NUMBER_ONLY;
     bool allow_underscores = false;
 
+    // Define how the options configure the conversion
+    auto configure = [&]() -> Implementation {
+        Implementation impl(UserType::REAL);
+        impl.set_inf_allowed(inf);
+        impl.set_nan_allowed(nan);
+        impl.set_consider(consider);
+        impl.set_underscores_allowed(allow_underscores);
+        return impl;
+    };
+
+    // Fast path for the common case of only giving the input
+    if (len_args == 1 && kwnames == nullptr) {
+        return check_with_defaults(args[0], configure);
+    }
+
     // Read the function arguments
     FN_PREPARE_ARGPARSER;
     // clang-format off
@@ -407,12 +1383,7 @@ static PyObject* fastnumbers_check_real(
 
     // Execute main logic in an exception handler to convert C++ exceptions
     return ExceptionHandler(input).run([&]() -> PyObject* {
-        Implementation impl(UserType::REAL);
-        impl.set_inf_allowed(inf);
-        impl.set_nan_allowed(nan);
-        impl.set_consider(consider);
-        impl.set_underscores_allowed(allow_underscores);
-        return impl.check(input);
+        return configure().check(input);
     });
 }
 
@@ -430,6 +1401,22 @@ static PyObject* fastnumbers_check_float(
     int strict = false;
     bool allow_underscores = false;
 
+    // Define how the options configure the conversion
+    auto configure = [&]() -> Implementation {
+        Implementation impl(UserType::FLOAT);
+        impl.set_inf_allowed(inf);
+        impl.set_nan_allowed(nan);
+        impl.set_consider(consider);
+        impl.set_strict(strict);
+        impl.set_underscores_allowed(allow_underscores);
+        return impl;
+    };
+
+    // Fast path for the common case of only giving the input
+    if (len_args == 1 && kwnames == nullptr) {
+        return check_with_defaults(args[0], configure);
+    }
+
     // Read the function arguments
     FN_PREPARE_ARGPARSER;
     // clang-format off
@@ -446,13 +1433,7 @@ static PyObject* fastnumbers_check_float(
 
     // Execute main logic in an exception handler to convert C++ exceptions
     return ExceptionHandler(input).run([&]() -> PyObject* {
-        Implementation impl(UserType::FLOAT);
-        impl.set_inf_allowed(inf);
-        impl.set_nan_allowed(nan);
-        impl.set_consider(consider);
-        impl.set_strict(strict);
-        impl.set_underscores_allowed(allow_underscores);
-        return impl.check(input);
+        return configure().check(input);
     });
 }
 
@@ -468,6 +1449,19 @@ static PyObject* fastnumbers_check_int(
     PyObject* pybase = nullptr;
     bool allow_underscores = false;
 
+    // Define how the options configure the conversion
+    auto configure = [&]() -> Implementation {
+        Implementation impl(UserType::INT, assess_integer_base_input(pybase));
+        impl.set_consider(consider);
+        impl.set_underscores_allowed(allow_underscores);
+        return impl;
+    };
+
+    // Fast path for the common case of only giving the input
+    if (len_args == 1 && kwnames == nullptr) {
+        return check_with_defaults(args[0], configure);
+    }
+
     // Read the function arguments
     FN_PREPARE_ARGPARSER;
     // clang-format off
@@ -482,10 +1476,7 @@ static PyObject* fastnumbers_check_int(
 
     // Execute main logic in an exception handler to convert C++ exceptions
     return ExceptionHandler(input).run([&]() -> PyObject* {
-        Implementation impl(UserType::INT, assess_integer_base_input(pybase));
-        impl.set_consider(consider);
-        impl.set_underscores_allowed(allow_underscores);
-        return impl.check(input);
+        return configure().check(input);
     });
 }
 
@@ -500,6 +1491,20 @@ static PyObject* fastnumbers_check_intlike(
     PyObject* consider = Py_None;
     bool allow_underscores = false;
 
+    // Define how the options configure the conversion
+    auto configure = [&]() -> Implementation {
+        Implementation impl(UserType::INTLIKE);
+        impl.set_consider(consider);
+        impl.set_coerce(true);
+        impl.set_underscores_allowed(allow_underscores);
+        return impl;
+    };
+
+    // Fast path for the common case of only giving the input
+    if (len_args == 1 && kwnames == nullptr) {
+        return check_with_defaults(args[0], configure);
+    }
+
     // Read the function arguments
     FN_PREPARE_ARGPARSER;
     // clang-format off
@@ -513,11 +1518,7 @@ static PyObject* fastnumbers_check_intlike(
 
     // Execute main logic in an exception handler to convert C++ exceptions
     return ExceptionHandler(input).run([&]() -> PyObject* {
-        Implementation impl(UserType::INTLIKE);
-        impl.set_consider(consider);
-        impl.set_coerce(true);
-        impl.set_underscores_allowed(allow_underscores);
-        return impl.check(input);
+        return configure().check(input);
     });
 }
 
@@ -573,6 +1574,19 @@ fastnumbers_float(PyObject* self, PyObject* const* args, Py_ssize_t len_args) no
 {
     PyObject* input = nullptr;
 
+    // Define how the options configure the conversion
+    auto configure = [&]() -> Implementation {
+        Implementation impl(UserType::FLOAT);
+        impl.set_unicode_allowed(false);
+        impl.set_underscores_allowed(true);
+        return impl;
+    };
+
+    // Fast path for the common case of only giving the input
+    if (len_args == 1) {
+        return convert_with_defaults(args[0], configure);
+    }
+
     // Read the function argument - do not accept it as a keyword argument
     FN_PREPARE_ARGPARSER;
     // clang-format off
@@ -589,10 +1603,7 @@ fastnumbers_float(PyObject* self, PyObject* const* args, Py_ssize_t len_args) no
 
     // Execute main logic in an exception handler to convert C++ exceptions
     return ExceptionHandler(input).run([&]() -> PyObject* {
-        Implementation impl(UserType::FLOAT);
-        impl.set_unicode_allowed(false);
-        impl.set_underscores_allowed(true);
-        return impl.convert(input);
+        return configure().convert(input);
     });
 }
 
@@ -606,6 +1617,19 @@ static PyObject* fastnumbers_int(
     PyObject* input = nullptr;
     PyObject* pybase = nullptr;
 
+    // Define how the options configure the conversion
+    auto configure = [&]() -> Implementation {
+        Implementation impl(UserType::INT, assess_integer_base_input(pybase));
+        impl.set_unicode_allowed(false);
+        impl.set_underscores_allowed(true);
+        return impl;
+    };
+
+    // Fast path for the common case of only giving the input
+    if (len_args == 1 && kwnames == nullptr) {
+        return convert_with_defaults(args[0], configure);
+    }
+
     // Read the function argument
     FN_PREPARE_ARGPARSER;
     // clang-format off
@@ -627,10 +1651,7 @@ static PyObject* fastnumbers_int(
 
     // Execute main logic in an exception handler to convert C++ exceptions
     return ExceptionHandler(input).run([&]() -> PyObject* {
-        Implementation impl(UserType::INT, assess_integer_base_input(pybase));
-        impl.set_unicode_allowed(false);
-        impl.set_underscores_allowed(true);
-        return impl.convert(input);
+        return configure().convert(input);
     });
 }
 
@@ -644,6 +1665,20 @@ static PyObject* fastnumbers_real(
     PyObject* input = nullptr;
     bool coerce = true;
 
+    // Define how the options configure the conversion
+    auto configure = [&]() -> Implementation {
+        Implementation impl(UserType::REAL);
+        impl.set_coerce(coerce);
+        impl.set_unicode_allowed(false);
+        impl.set_underscores_allowed(true);
+        return impl;
+    };
+
+    // Fast path for the common case of only giving the input
+    if (len_args == 1 && kwnames == nullptr) {
+        return convert_with_defaults(args[0], configure);
+    }
+
     // Read the function arguments
     FN_PREPARE_ARGPARSER;
     // clang-format off
@@ -661,11 +1696,7 @@ static PyObject* fastnumbers_real(
 
     // Execute main logic in an exception handler to convert C++ exceptions
     return ExceptionHandler(input).run([&]() -> PyObject* {
-        Implementation impl(UserType::REAL);
-        impl.set_coerce(coerce);
-        impl.set_unicode_allowed(false);
-        impl.set_underscores_allowed(true);
-        return impl.convert(input);
+        return configure().convert(input);
     });
 }
 
@@ -999,6 +2030,787 @@ static PyObject* fastnumbers_isintlike(
     });
 }
 
+/**
+ * \struct Converter
+ * \brief A reusable conversion function with pre-validated options
+ *
+ * This is a PyObject "subclass" that stores a fully configured Implementation
+ * so that repeated calls need not parse and validate arguments.
+ *
+ * It is written in a very C-like way because it has to interface with C-code.
+ */
+struct Converter {
+    // clang-format off
+    PyObject_HEAD
+
+#ifdef Py_TPFLAGS_HAVE_VECTORCALL
+    /// The function called when the converter is called with vectorcall
+    vectorcallfunc vectorcall;
+#endif
+    // clang-format on
+
+    /// The configured conversion logic
+    Implementation* impl;
+
+    /// The name of the try_* function this converter behaves like
+    PyObject* kind;
+
+    /// The action to take for INF when populating an array
+    PyObject* inf;
+
+    /// The action to take for NaN when populating an array
+    PyObject* nan;
+
+    /// The action to take on conversion failure when populating an array
+    PyObject* on_fail;
+
+    /// The action to take on overflow when populating an array
+    PyObject* on_overflow;
+
+    /// The action to take on type error when populating an array
+    PyObject* on_type_error;
+
+    /// Whether or not underscores are allowed when populating an array
+    bool allow_underscores;
+
+    /// The integer base to use when populating an array
+    int base;
+
+    /// Create and validate a new converter
+    static PyObject*
+    create(PyTypeObject* type, PyObject* args, PyObject* kwargs) noexcept
+    {
+        PyObject* kind = nullptr;
+        PyObject* inf = Selectors::ALLOWED;
+        PyObject* nan = Selectors::ALLOWED;
+        PyObject* on_fail = Selectors::INPUT;
+        PyObject* on_overflow = Selectors::RAISE;
+        PyObject* on_type_error = Selectors::RAISE;
+        int coerce = true;
+        PyObject* pybase = nullptr;
+        int allow_underscores = false;
+
+        // Construction is not performance critical, so use the standard parser
+        static const char* keywords[] = {
+            "kind",          "inf",    "nan",  "on_fail",           "on_overflow",
+            "on_type_error", "coerce", "base", "allow_underscores", nullptr,
+        };
+        if (!PyArg_ParseTupleAndKeywords(
+                args,
+                kwargs,
+                "|U$OOOOOpOp:Converter",
+                const_cast<char**>(keywords),
+                &kind,
+                &inf,
+                &nan,
+                &on_fail,
+                &on_overflow,
+                &on_type_error,
+                &coerce,
+                &pybase,
+                &allow_underscores
+            )) {
+            return nullptr;
+        }
+        if (kind == nullptr) {
+            kind = PyUnicode_InternFromString("real");
+            if (kind == nullptr) {
+                return nullptr;
+            }
+        } else {
+            Py_INCREF(kind);
+        }
+
+        PyObject* result = ExceptionHandler(kind).run([&]() -> PyObject* {
+            const int base = assess_integer_base_input(pybase);
+            const UserType ntype = user_type_from_kind(kind);
+
+            // Only pass on the options that the equivalent try_* function accepts
+            Implementation impl(ntype, ntype == UserType::INT ? base : 10);
+            impl.set_fail_action(on_fail);
+            impl.set_type_error_action(on_type_error);
+            if (ntype == UserType::REAL || ntype == UserType::FLOAT) {
+                impl.set_inf_action(inf);
+                impl.set_nan_action(nan);
+            }
+            if (ntype == UserType::REAL) {
+                impl.set_coerce(coerce);
+            }
+            if (ntype == UserType::INT) {
+                impl.set_unicode_allowed(); // determine from base
+            }
+            impl.set_underscores_allowed(allow_underscores);
+
+            Converter* self = reinterpret_cast<Converter*>(type->tp_alloc(type, 0));
+            if (self == nullptr) {
+                throw exception_is_set();
+            }
+#ifdef Py_TPFLAGS_HAVE_VECTORCALL
+            self->vectorcall = (vectorcallfunc)Converter::vectorcall_convert;
+#endif
+            self->impl = new Implementation(std::move(impl));
+            self->kind = kind;
+            self->inf = Selectors::incref(inf);
+            self->nan = Selectors::incref(nan);
+
+            // An array cannot hold the input, so raise as try_array would
+            self->on_fail = Selectors::incref(
+                on_fail == Selectors::INPUT ? Selectors::RAISE : on_fail
+            );
+            self->on_overflow = Selectors::incref(on_overflow);
+            self->on_type_error = Selectors::incref(on_type_error);
+            self->allow_underscores = allow_underscores;
+            self->base = base;
+            return reinterpret_cast<PyObject*>(self);
+        });
+
+        // On success the converter owns the reference to kind
+        if (result == nullptr) {
+            Py_DECREF(kind);
+        }
+        return result;
+    }
+
+    /// Deallocate the converter object
+    static void dealloc(Converter* self) noexcept
+    {
+        PyObject_GC_UnTrack(self);
+        delete self->impl;
+        Py_DECREF(self->kind);
+        Selectors::decref(self->inf);
+        Selectors::decref(self->nan);
+        Selectors::decref(self->on_fail);
+        Selectors::decref(self->on_overflow);
+        Selectors::decref(self->on_type_error);
+        Py_TYPE(self)->tp_free(reinterpret_cast<PyObject*>(self));
+    }
+
+    /// Visit the objects held by the converter for garbage collection
+    static int traverse(Converter* self, visitproc visit, void* arg) noexcept
+    {
+        Py_VISIT(self->kind);
+        PyObject* const actions[] = {
+            self->inf, self->nan, self->on_fail, self->on_overflow, self->on_type_error,
+        };
+        for (PyObject* obj : actions) {
+            if (const int result = Selectors::traverse(obj, visit, arg)) {
+                return result;
+            }
+        }
+        return self->impl == nullptr ? 0 : self->impl->traverse(visit, arg);
+    }
+
+    /// Release the objects held by the converter that may refer back to it
+    static int clear(Converter* self) noexcept
+    {
+        Selectors::reset(self->inf, Selectors::ALLOWED);
+        Selectors::reset(self->nan, Selectors::ALLOWED);
+        Selectors::reset(self->on_fail, Selectors::RAISE);
+        Selectors::reset(self->on_overflow, Selectors::RAISE);
+        Selectors::reset(self->on_type_error, Selectors::RAISE);
+        if (self->impl != nullptr) {
+            self->impl->clear();
+        }
+        return 0;
+    }
+
+    /// Show the kind of conversion performed
+    static PyObject* repr(Converter* self) noexcept
+    {
+        return PyUnicode_FromFormat("fastnumbers.Converter(kind=%R)", self->kind);
+    }
+
+    /// Convert a single value
+    static PyObject* convert(Converter* self, PyObject* input) noexcept
+    {
+        return ExceptionHandler(input).run([&]() -> PyObject* {
+            return self->impl->convert(input);
+        });
+    }
+
+#ifdef Py_TPFLAGS_HAVE_VECTORCALL
+    /// Call the converter using vectorcall - only a single positional is accepted
+    static PyObject* vectorcall_convert(
+        Converter* self, PyObject* const* args, size_t nargsf, PyObject* kwnames
+    ) noexcept
+    {
+        const Py_ssize_t nargs = PyVectorcall_NARGS(nargsf);
+        if (nargs != 1 || (kwnames != nullptr && PyTuple_GET_SIZE(kwnames) != 0)) {
+            return raise_bad_call();
+        }
+        return convert(self, args[0]);
+    }
+#endif
+
+    /// Call the converter using tp_call - only a single positional is accepted
+    static PyObject*
+    call_convert(Converter* self, PyObject* args, PyObject* kwargs) noexcept
+    {
+        if (PyTuple_GET_SIZE(args) != 1 || (kwargs != nullptr && PyDict_Size(kwargs))) {
+            return raise_bad_call();
+        }
+        return convert(self, PyTuple_GET_ITEM(args, 0));
+    }
+
+    /// Convert each element of an iterable into an iterator
+    static PyObject* map(Converter* self, PyObject* input) noexcept
+    {
+        return ExceptionHandler(input).run([&]() -> PyObject* {
+            // The Implementation object is copied so that it stays in memory
+            // for as long as the iterator, even if the converter does not.
+            return choose_execution_scheme(input, *self->impl, Py_True);
+        });
+    }
+
+    /// Convert each element of an iterable into a list
+    static PyObject* list(Converter* self, PyObject* input) noexcept
+    {
+        return ExceptionHandler(input).run([&]() -> PyObject* {
+            return choose_execution_scheme(input, *self->impl, (PyObject*)&PyList_Type);
+        });
+    }
+
+    /// Convert each element of an iterable into an existing array
+    static PyObject* array(
+        Converter* self, PyObject* const* args, Py_ssize_t len_args, PyObject* kwnames
+    ) noexcept
+    {
+        PyObject* input = nullptr;
+        PyObject* output = nullptr;
+
+        // Read the function arguments
+        FN_PREPARE_ARGPARSER;
+        // clang-format off
+        if (fn_parse_arguments("array", args, len_args, kwnames,
+                               "input", false,  &input,
+                               "output", false, &output,
+                               nullptr, false, nullptr
+            )) return nullptr;
+        // clang-format on
+
+        // Execute main logic in an exception handler to convert C++ exceptions
+        return ExceptionHandler(input).run([&]() -> PyObject* {
+            array_impl(
+                input,
+                output,
+                self->inf,
+                self->nan,
+                self->on_fail,
+                self->on_overflow,
+                self->on_type_error,
+                self->allow_underscores,
+                false,
+                false,
+                self->base
+            );
+
+            // No return value, need to return None
+            Py_RETURN_NONE;
+        });
+    }
+
+    /**
+     * \brief Determine the user type from the name of a try_* function
+     * \param kind A Python str naming the try_* function
+     * \throws fastnumbers_exception if the kind is not valid
+     */
+    static UserType user_type_from_kind(PyObject* kind) noexcept(false)
+    {
+        if (PyUnicode_CompareWithASCIIString(kind, "real") == 0) {
+            return UserType::REAL;
+        } else if (PyUnicode_CompareWithASCIIString(kind, "float") == 0) {
+            return UserType::FLOAT;
+        } else if (PyUnicode_CompareWithASCIIString(kind, "int") == 0) {
+            return UserType::INT;
+        } else if (PyUnicode_CompareWithASCIIString(kind, "forceint") == 0) {
+            return UserType::FORCEINT;
+        }
+        throw fastnumbers_exception(
+            "kind must be one of 'real', 'float', 'int', or 'forceint'"
+        );
+    }
+
+    /// Raise the error for calling with anything but a single positional argument
+    static PyObject* raise_bad_call() noexcept
+    {
+        PyErr_SetString(
+            PyExc_TypeError, "Converter() takes exactly one positional argument"
+        );
+        return nullptr;
+    }
+};
+
+/// Extra methods of the converter object not standard in a type object
+static PyMethodDef converter_methods[] = {
+    { "map", (PyCFunction)Converter::map, METH_O, Converter_map__doc__ },
+    { "list", (PyCFunction)Converter::list, METH_O, Converter_list__doc__ },
+    { "array",
+      (PyCFunction)Converter::array,
+      METH_FASTCALL | METH_KEYWORDS,
+      Converter_array__doc__ },
+    { nullptr, nullptr, 0, nullptr } /* sentinel */
+};
+
+#ifdef Py_TPFLAGS_HAVE_VECTORCALL
+#define FN_CONVERTER_VECTORCALL_OFFSET offsetof(Converter, vectorcall)
+#define FN_CONVERTER_FLAGS \
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC | Py_TPFLAGS_HAVE_VECTORCALL
+#else
+#define FN_CONVERTER_VECTORCALL_OFFSET 0
+#define FN_CONVERTER_FLAGS Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC
+#endif
+
+/// The converter type object definition
+static PyTypeObject ConverterType = {
+    PyVarObject_HEAD_INIT(nullptr, 0) "fastnumbers.Converter", /* tp_name */
+    sizeof(Converter), /* tp_basicsize */
+    0, /* tp_itemsize */
+    /* methods */
+    (destructor)Converter::dealloc, /* tp_dealloc */
+    FN_CONVERTER_VECTORCALL_OFFSET, /* tp_vectorcall_offset */
+    0, /* tp_getattr */
+    0, /* tp_setattr */
+    0, /* tp_as_async */
+    (reprfunc)Converter::repr, /* tp_repr */
+    0, /* tp_as_number */
+    0, /* tp_as_sequence */
+    0, /* tp_as_mapping */
+    0, /* tp_hash */
+    (ternaryfunc)Converter::call_convert, /* tp_call */
+    0, /* tp_str */
+    PyObject_GenericGetAttr, /* tp_getattro */
+    0, /* tp_setattro */
+    0, /* tp_as_buffer */
+    FN_CONVERTER_FLAGS, /* tp_flags */
+    Converter__doc__, /* tp_doc */
+    (traverseproc)Converter::traverse, /* tp_traverse */
+    (inquiry)Converter::clear, /* tp_clear */
+    0, /* tp_richcompare */
+    0, /* tp_weaklistoffset */
+    0, /* tp_iter */
+    0, /* tp_iternext */
+    converter_methods, /* tp_methods */
+    0, /* tp_members */
+    0, /* tp_getset */
+    0, /* tp_base */
+    0, /* tp_dict */
+    0, /* tp_descr_get */
+    0, /* tp_descr_set */
+    0, /* tp_dictoffset */
+    0, /* tp_init */
+    0, /* tp_alloc */
+    Converter::create, /* tp_new */
+};
+
+/**
+ * \struct TextStream
+ * \brief The native state of a StreamParser
+ *
+ * This keeps the incomplete record at the end of the text so far in a C++
+ * buffer (see RecordStream), together with the options for converting
+ * the tokens. A chunk is first staged with feed() or end(), which gives the
+ * number of tokens, and then the tokens are parsed into an array of that
+ * length with parse().
+ *
+ * It is written in a very C-like way because it has to interface with C-code.
+ */
+struct TextStream {
+    // clang-format off
+    PyObject_HEAD
+    // clang-format on
+
+    /// The records of the text
+    RecordStream* stream;
+
+    /// The staged chunk, if it is still needed by the stream
+    Py_buffer chunk;
+
+    /// Whether or not a staged chunk is held
+    bool has_chunk;
+
+    /// Whether or not the stream is in use, which may release the GIL
+    bool busy;
+
+    /// The action to take for INF
+    PyObject* inf;
+
+    /// The action to take for NaN
+    PyObject* nan;
+
+    /// The action to take on conversion failure
+    PyObject* on_fail;
+
+    /// The action to take on overflow
+    PyObject* on_overflow;
+
+    /// Whether or not underscores are allowed
+    bool allow_underscores;
+
+    /// The integer base to use
+    int base;
+
+    /// Create and validate a new stream
+    static PyObject*
+    create(PyTypeObject* type, PyObject* args, PyObject* kwargs) noexcept
+    {
+        PyObject* sep = nullptr;
+        PyObject* delimiter = nullptr;
+        PyObject* usecol = nullptr;
+        PyObject* skip = nullptr;
+        PyObject* inf = Selectors::ALLOWED;
+        PyObject* nan = Selectors::ALLOWED;
+        PyObject* on_fail = Selectors::RAISE;
+        PyObject* on_overflow = Selectors::RAISE;
+        PyObject* pybase = nullptr;
+        int allow_underscores = false;
+
+        // Construction is not performance critical, so use the standard parser
+        static const char* keywords[] = {
+            "sep",     "delimiter",   "usecol", "skip",
+            "inf",     "nan",         "on_fail", "on_overflow",
+            "base",    "allow_underscores", nullptr,
+        };
+        if (!PyArg_ParseTupleAndKeywords(
+                args,
+                kwargs,
+                "O|$OOOOOOOOp:TextStream",
+                const_cast<char**>(keywords),
+                &sep,
+                &delimiter,
+                &usecol,
+                &skip,
+                &inf,
+                &nan,
+                &on_fail,
+                &on_overflow,
+                &pybase,
+                &allow_underscores
+            )) {
+            return nullptr;
+        }
+
+        return ExceptionHandler(sep).run([&]() -> PyObject* {
+            const std::string_view record_sep = assess_separator_input("sep", sep);
+            const std::string_view field_sep = delimiter == nullptr
+                ? std::string_view()
+                : assess_separator_input("delimiter", delimiter);
+            const Py_ssize_t column
+                = assess_count_input("usecol", usecol, Tokenizer::WHOLE_RECORD);
+            if (column != Tokenizer::WHOLE_RECORD && field_sep.empty()) {
+                throw fastnumbers_exception("'delimiter' must be given with 'usecol'");
+            }
+            const Py_ssize_t nskip = assess_count_input("skip", skip, 0);
+            const int base = assess_integer_base_input(pybase);
+
+            TextStream* self = reinterpret_cast<TextStream*>(type->tp_alloc(type, 0));
+            if (self == nullptr) {
+                throw exception_is_set();
+            }
+            self->stream = new RecordStream(record_sep, field_sep, column, nskip);
+            self->has_chunk = false;
+            self->busy = false;
+            self->inf = Selectors::incref(inf);
+            self->nan = Selectors::incref(nan);
+            self->on_fail = Selectors::incref(on_fail);
+            self->on_overflow = Selectors::incref(on_overflow);
+            self->allow_underscores = allow_underscores;
+            self->base = base;
+            return reinterpret_cast<PyObject*>(self);
+        });
+    }
+
+    /// Deallocate the stream object
+    static void dealloc(TextStream* self) noexcept
+    {
+        PyObject_GC_UnTrack(self);
+        delete self->stream;
+        release_chunk(self);
+        Selectors::decref(self->inf);
+        Selectors::decref(self->nan);
+        Selectors::decref(self->on_fail);
+        Selectors::decref(self->on_overflow);
+        Py_TYPE(self)->tp_free(reinterpret_cast<PyObject*>(self));
+    }
+
+    /// Visit the objects held by the stream for garbage collection
+    static int traverse(TextStream* self, visitproc visit, void* arg) noexcept
+    {
+        if (self->has_chunk) {
+            Py_VISIT(self->chunk.obj);
+        }
+        PyObject* const actions[] = {
+            self->inf, self->nan, self->on_fail, self->on_overflow,
+        };
+        for (PyObject* obj : actions) {
+            if (const int result = Selectors::traverse(obj, visit, arg)) {
+                return result;
+            }
+        }
+        return 0;
+    }
+
+    /// Release the actions of the stream, which may refer back to it
+    static int clear(TextStream* self) noexcept
+    {
+        Selectors::reset(self->inf, Selectors::ALLOWED);
+        Selectors::reset(self->nan, Selectors::ALLOWED);
+        Selectors::reset(self->on_fail, Selectors::RAISE);
+        Selectors::reset(self->on_overflow, Selectors::RAISE);
+        return 0;
+    }
+
+    /// Stage the records a chunk completes, returning how many tokens there are
+    static PyObject* feed(TextStream* self, PyObject* chunk) noexcept
+    {
+        return ExceptionHandler(chunk).run([&]() -> PyObject* {
+            const Guard guard(self);
+            release_chunk(self);
+            if (PyObject_GetBuffer(chunk, &self->chunk, PyBUF_SIMPLE) != 0) {
+                throw exception_is_set();
+            }
+            self->has_chunk = true;
+
+            const std::string_view text(
+                static_cast<const char*>(self->chunk.buf),
+                static_cast<std::size_t>(self->chunk.len)
+            );
+            Py_ssize_t count = -1;
+            {
+                GILReleaser gil;
+                if (self->stream->stage(text)) {
+                    count = self->stream->tokens().count();
+                }
+            }
+
+            // A chunk that completes no record was copied, so is not needed
+            if (count < 0) {
+                release_chunk(self);
+                Py_RETURN_NONE;
+            }
+            return PyLong_FromSsize_t(count);
+        });
+    }
+
+    /// Stage the incomplete record at the end of the text
+    static PyObject* end(TextStream* self, PyObject*) noexcept
+    {
+        return ExceptionHandler(Py_None).run([&]() -> PyObject* {
+            const Guard guard(self);
+            release_chunk(self);
+            self->stream->stage_end();
+            return PyLong_FromSsize_t(self->stream->tokens().count());
+        });
+    }
+
+    /// Parse the staged tokens into an array, consuming them on success
+    static PyObject* parse(TextStream* self, PyObject* output) noexcept
+    {
+        return ExceptionHandler(output).run([&]() -> PyObject* {
+            const Guard guard(self);
+            try {
+                parse_staged(self, output);
+            } catch (...) {
+                self->stream->discard();
+                release_chunk(self);
+                throw;
+            }
+            self->stream->commit();
+            release_chunk(self);
+            Py_RETURN_NONE;
+        });
+    }
+
+    /**
+     * \brief Parse the text decompressed from gzip or zlib compressed input
+     *
+     * The input is read with a file object's read method, and decompressed
+     * into reusable native buffers in a worker thread while the previous
+     * block is parsed, so the decompressed text is never a Python object.
+     * The records each block completes are parsed into the array that
+     * claim(count) returns for them. The incomplete record at the end
+     * of the text is left to be staged with end().
+     */
+    static PyObject* inflate(
+        TextStream* self, PyObject* const* args, Py_ssize_t len_args, PyObject* kwnames
+    ) noexcept
+    {
+        PyObject* read = nullptr;
+        PyObject* claim = nullptr;
+        PyObject* pyblock_size = nullptr;
+        bool threads = true;
+
+        // Read the function arguments
+        FN_PREPARE_ARGPARSER;
+        // clang-format off
+        if (fn_parse_arguments("inflate", args, len_args, kwnames,
+                               "read", false, &read,
+                               "claim", false, &claim,
+                               "$block_size", false, &pyblock_size,
+                               "$threads", true, &threads,
+                               nullptr, false, nullptr
+            )) return nullptr;
+        // clang-format on
+
+        return ExceptionHandler(read).run([&]() -> PyObject* {
+            const Guard guard(self);
+            const Py_ssize_t block_size
+                = assess_count_input("block_size", pyblock_size, 1 << 20);
+            if (block_size == 0) {
+                throw fastnumbers_exception("'block_size' must be positive, not 0");
+            }
+            release_chunk(self);
+
+            Inflater inflater(read, static_cast<std::size_t>(block_size), threads);
+            while (const std::optional<std::string_view> block = inflater.next()) {
+                if (!self->stream->stage(*block)) {
+                    continue;
+                }
+                Py_ssize_t count = 0;
+                {
+                    GILReleaser gil;
+                    count = self->stream->tokens().count();
+                }
+
+                PyObject* output = PyObject_CallFunction(claim, "n", count);
+                if (output == nullptr) {
+                    self->stream->discard();
+                    throw exception_is_set();
+                }
+                try {
+                    parse_staged(self, output);
+                } catch (...) {
+                    Py_DECREF(output);
+                    self->stream->discard();
+                    throw;
+                }
+                Py_DECREF(output);
+                self->stream->commit();
+            }
+            Py_RETURN_NONE;
+        });
+    }
+
+    /// Forget all text
+    static PyObject* reset(TextStream* self, PyObject*) noexcept
+    {
+        return ExceptionHandler(Py_None).run([&]() -> PyObject* {
+            const Guard guard(self);
+            self->stream->reset();
+            release_chunk(self);
+            Py_RETURN_NONE;
+        });
+    }
+
+    /// Parse the staged tokens into an array
+    static void parse_staged(TextStream* self, PyObject* output) noexcept(false)
+    {
+        Tokenizer tokens = self->stream->tokens();
+        tokens_array_impl(
+            tokens,
+            output,
+            self->inf,
+            self->nan,
+            self->on_fail,
+            self->on_overflow,
+            self->allow_underscores,
+            self->base
+        );
+    }
+
+    /// Release the staged chunk, if one is held
+    static void release_chunk(TextStream* self) noexcept
+    {
+        if (self->has_chunk) {
+            PyBuffer_Release(&self->chunk);
+            self->has_chunk = false;
+        }
+    }
+
+    /**
+     * \class Guard
+     * \brief Mark the stream as in use for the lifetime of this object
+     *
+     * Parsing can call back into Python and release the GIL, so a callback
+     * or another thread could otherwise change the stream while it is used.
+     */
+    class Guard {
+    public:
+        explicit Guard(TextStream* self) noexcept(false)
+            : m_self(self)
+        {
+            if (m_self->busy) {
+                PyErr_SetString(
+                    PyExc_RuntimeError, "StreamParser cannot be used while it is parsing"
+                );
+                throw exception_is_set();
+            }
+            m_self->busy = true;
+        }
+        Guard(const Guard&) = delete;
+        Guard(Guard&&) = delete;
+        Guard& operator=(const Guard&) = delete;
+        ~Guard() noexcept { m_self->busy = false; }
+
+    private:
+        TextStream* m_self;
+    };
+};
+
+/// Extra methods of the stream object not standard in a type object
+static PyMethodDef text_stream_methods[] = {
+    { "feed", (PyCFunction)TextStream::feed, METH_O, nullptr },
+    { "end", (PyCFunction)TextStream::end, METH_NOARGS, nullptr },
+    { "parse", (PyCFunction)TextStream::parse, METH_O, nullptr },
+    { "inflate",
+      (PyCFunction)TextStream::inflate,
+      METH_FASTCALL | METH_KEYWORDS,
+      nullptr },
+    { "reset", (PyCFunction)TextStream::reset, METH_NOARGS, nullptr },
+    { nullptr, nullptr, 0, nullptr } /* sentinel */
+};
+
+/// The stream type object definition
+static PyTypeObject TextStreamType = {
+    PyVarObject_HEAD_INIT(nullptr, 0) "fastnumbers.TextStream", /* tp_name */
+    sizeof(TextStream), /* tp_basicsize */
+    0, /* tp_itemsize */
+    /* methods */
+    (destructor)TextStream::dealloc, /* tp_dealloc */
+    0, /* tp_vectorcall_offset */
+    0, /* tp_getattr */
+    0, /* tp_setattr */
+    0, /* tp_as_async */
+    0, /* tp_repr */
+    0, /* tp_as_number */
+    0, /* tp_as_sequence */
+    0, /* tp_as_mapping */
+    0, /* tp_hash */
+    0, /* tp_call */
+    0, /* tp_str */
+    PyObject_GenericGetAttr, /* tp_getattro */
+    0, /* tp_setattro */
+    0, /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC, /* tp_flags */
+    "C-implementation of StreamParser", /* tp_doc */
+    (traverseproc)TextStream::traverse, /* tp_traverse */
+    (inquiry)TextStream::clear, /* tp_clear */
+    0, /* tp_richcompare */
+    0, /* tp_weaklistoffset */
+    0, /* tp_iter */
+    0, /* tp_iternext */
+    text_stream_methods, /* tp_methods */
+    0, /* tp_members */
+    0, /* tp_getset */
+    0, /* tp_base */
+    0, /* tp_dict */
+    0, /* tp_descr_get */
+    0, /* tp_descr_set */
+    0, /* tp_dictoffset */
+    0, /* tp_init */
+    0, /* tp_alloc */
+    TextStream::create, /* tp_new */
+};
+
 // Define the methods contained in this module
 static PyMethodDef FastnumbersMethods[] = {
     { "try_real",
@@ -1021,6 +2833,26 @@ static PyMethodDef FastnumbersMethods[] = {
       (PyCFunction)fastnumbers_array,
       METH_FASTCALL | METH_KEYWORDS,
       "C-implementation of try_array" },
+    { "parse_text",
+      (PyCFunction)fastnumbers_parse_text,
+      METH_FASTCALL | METH_KEYWORDS,
+      "C-implementation of parse_file" },
+    { "parse_delimited",
+      (PyCFunction)fastnumbers_parse_delimited,
+      METH_FASTCALL | METH_KEYWORDS,
+      "C-implementation of parse_columns" },
+    { "parse_fixed",
+      (PyCFunction)fastnumbers_parse_fixed,
+      METH_FASTCALL | METH_KEYWORDS,
+      "C-implementation of parse_fixed_width" },
+    { "rows",
+      (PyCFunction)fastnumbers_rows,
+      METH_FASTCALL | METH_KEYWORDS,
+      "C-implementation of try_rows" },
+    { "parse_json",
+      (PyCFunction)fastnumbers_parse_json,
+      METH_FASTCALL | METH_KEYWORDS,
+      "C-implementation of parse_json_numbers" },
     { "check_real",
       (PyCFunction)fastnumbers_check_real,
       METH_FASTCALL | METH_KEYWORDS,
@@ -1041,6 +2873,26 @@ static PyMethodDef FastnumbersMethods[] = {
       (PyCFunction)fastnumbers_query_type,
       METH_FASTCALL | METH_KEYWORDS,
       query_type__doc__ },
+    { "natsort_key",
+      (PyCFunction)fastnumbers_natsort_key,
+      METH_FASTCALL | METH_KEYWORDS,
+      natsort_key__doc__ },
+    { "natsort_keys",
+      (PyCFunction)fastnumbers_natsort_keys,
+      METH_FASTCALL | METH_KEYWORDS,
+      natsort_keys__doc__ },
+    { "natcmp",
+      (PyCFunction)fastnumbers_natcmp,
+      METH_FASTCALL | METH_KEYWORDS,
+      natcmp__doc__ },
+    { "natsorted",
+      (PyCFunction)fastnumbers_natsorted,
+      METH_FASTCALL | METH_KEYWORDS,
+      natsorted__doc__ },
+    { "find_numbers",
+      (PyCFunction)fastnumbers_find_numbers,
+      METH_FASTCALL | METH_KEYWORDS,
+      find_numbers__doc__ },
     { "int",
       (PyCFunction)fastnumbers_int,
       METH_FASTCALL | METH_KEYWORDS,
@@ -1133,6 +2985,20 @@ PyMODINIT_FUNC PyInit_fastnumbers()
     PyModule_AddObject(m, "STRING_ONLY", Selectors::STRING_ONLY);
     PyModule_AddObject(m, "NUMBER_ONLY", Selectors::NUMBER_ONLY);
 
+    // Types
+    if (PyType_Ready(&ConverterType) < 0) {
+        Py_DECREF(m);
+        return nullptr;
+    }
+    Py_INCREF(&ConverterType);
+    PyModule_AddObject(m, "Converter", (PyObject*)&ConverterType);
+    if (PyType_Ready(&TextStreamType) < 0) {
+        Py_DECREF(m);
+        return nullptr;
+    }
+    Py_INCREF(&TextStreamType);
+    PyModule_AddObject(m, "TextStream", (PyObject*)&TextStreamType);
+
     // Constants cached for internal use
     PyObject* pos_inf_str = PyBytes_FromString("+infinity");
     PyObject* neg_inf_str = PyBytes_FromString("-infinity");
@@ -1147,5 +3013,9 @@ PyMODINIT_FUNC PyInit_fastnumbers()
     Py_DecRef(pos_nan_str);
     Py_DecRef(neg_nan_str);
 
+    // Numpy scalar types and string arrays whose values can be read directly
+    NumpyScalar::load_types();
+    StringBuffer::load_api();
+
     return m;
 }
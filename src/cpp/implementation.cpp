@@ -1,27 +1,42 @@
 /*
  * This file contains the high-level implementations for the Python-exposed functions
  */
+#include <algorithm>
 #include <limits>
+#include <memory>
+#include <numeric>
+#include <optional>
 #include <string_view>
+#include <type_traits>
+#include <utility>
 #include <variant>
+#include <vector>
 
 #include <Python.h>
 
+#include "fastnumbers/cache.hpp"
+#include "fastnumbers/columns.hpp"
 #include "fastnumbers/ctype_extractor.hpp"
 #include "fastnumbers/evaluator.hpp"
 #include "fastnumbers/exception.hpp"
 #include "fastnumbers/extractor.hpp"
+#include "fastnumbers/gil.hpp"
 #include "fastnumbers/implementation.hpp"
 #include "fastnumbers/iteration.hpp"
+#include "fastnumbers/natural.hpp"
+#include "fastnumbers/numeric_buffer.hpp"
 #include "fastnumbers/parser.hpp"
 #include "fastnumbers/payload.hpp"
 #include "fastnumbers/resolver.hpp"
 #include "fastnumbers/selectors.hpp"
+#include "fastnumbers/string_buffer.hpp"
+#include "fastnumbers/text_buffer.hpp"
+#include "fastnumbers/tokenizer.hpp"
 #include "fastnumbers/user_options.hpp"
 
 PyObject* Implementation::convert(PyObject* input) const noexcept(false)
 {
-    return m_resolver.resolve(input, collect_payload(input));
+    return convert(input, m_options);
 }
 
 PyObject* Implementation::check(PyObject* input) const noexcept(false)
@@ -101,22 +116,6 @@ void Implementation::set_allowed_types(PyObject* val) noexcept(false)
     m_allowed_types = Selectors::incref(val);
 }
 
-Payload Implementation::collect_payload(PyObject* obj) const noexcept(false)
-{
-    Buffer buffer;
-
-    // extract_parser() is responsible for taking a python object
-    // and returning the Parser object best suited to parser the object's data.
-    // std:visit is used to obtain the payload data no matter which parser was
-    // returned.
-    return std::visit(
-        [this, obj](const auto& parser) -> Payload {
-            return Evaluator<decltype(parser)>(obj, m_options, parser).as_type(m_ntype);
-        },
-        extract_parser(obj, buffer, m_options)
-    );
-}
-
 NumberFlags Implementation::collect_type(PyObject* obj) const noexcept(false)
 {
     Buffer buffer;
@@ -202,26 +201,6 @@ void Implementation::validate_not_disallow(const PyObject* selector) const
     }
 }
 
-// Implementation for iterating over a collection to populate a list
-PyObject* list_iteration_impl(
-    PyObject* input, std::function<PyObject*(PyObject*)> convert
-) noexcept(false)
-{
-    // Create a python list into which to store the return values
-    ListBuilder list_builder(input);
-
-    // The helper for iterating over the Python iterable
-    IterableManager<PyObject*> iter_manager(input, convert);
-
-    // For each element in the Python iterable, convert it and append to the list
-    for (auto& value : iter_manager) {
-        list_builder.append(value);
-    }
-
-    // Return the list to the user
-    return list_builder.get();
-}
-
 /**
  * \struct FastnumbersIterator
  * \brief Object containing the state of the fastnumbers iterator
@@ -229,6 +208,13 @@ PyObject* list_iteration_impl(
  * This is a PyObject "subclass" that enables iterating over fastnumbers
  * results.
  *
+ * To reduce the per-element overhead, when the input elements can be
+ * accessed directly a chunk of elements is converted at once and the
+ * results are handed out one-by-one. If a conversion fails, its exception
+ * is stored and only raised once the results before it have been handed out.
+ * Conversions that may run Python code (user callables, or objects other
+ * than the built-in number and string types) are never done ahead of time.
+ *
  * It is written in a very C-like way because it has to interface with C-code.
  */
 struct FastnumbersIterator {
@@ -239,20 +225,45 @@ struct FastnumbersIterator {
     PyObject* it_input;
     // clang-format on
 
+    /// The maximum number of elements to convert before they are requested
+    static constexpr Py_ssize_t CHUNK_SIZE = 256;
+
     /// Pointer to the active IterableManager
     IterableManager<PyObject*>* it_man;
 
-    /// The C++ iterator
-    IterableManager<PyObject*>::ItemIterator it_iter;
+    /// Whether or not elements may be converted before they are requested
+    bool it_read_ahead;
+
+    /// An element taken from the input but not yet converted, if any
+    PyObject* it_pending;
+
+    /// Converted results that have not yet been handed out
+    PyObject* it_ready[CHUNK_SIZE];
+
+    /// The location in it_ready of the next result to hand out
+    Py_ssize_t it_ready_index;
+
+    /// The number of results in it_ready
+    Py_ssize_t it_ready_count;
 
-    // Track if this is the first iteration or not
-    bool it_first;
+    /// The exception to raise once the ready results are handed out, if any
+    PyObject* it_error_type;
+    PyObject* it_error_value;
+    PyObject* it_error_traceback;
 
     /// Deallocate the itertor object
     static void dealloc(FastnumbersIterator* it) noexcept
     {
+        for (Py_ssize_t i = it->it_ready_index; i < it->it_ready_count; ++i) {
+            Py_DECREF(it->it_ready[i]);
+        }
+        Py_XDECREF(it->it_error_type);
+        Py_XDECREF(it->it_error_value);
+        Py_XDECREF(it->it_error_traceback);
+        Py_XDECREF(it->it_pending);
         Py_DECREF(it->it_input);
         delete it->it_man;
+        PyObject_Del(it);
     }
 
     /// Get a guess of the length of the iterator
@@ -263,32 +274,89 @@ struct FastnumbersIterator {
     }
 
     /// Return the next value of the iterator
-    static PyObject* next(FastnumbersIterator* it) noexcept(false)
+    static PyObject* next(FastnumbersIterator* it) noexcept
     {
         assert(it != nullptr);
         assert(it->it_man != nullptr);
 
-        // Run inside an exception handler to ensure anything we throw gets converted
-        // into a Python exception.
-        return ExceptionHandler(it->it_input).run([&it]() -> PyObject* {
-            // On the first iteration, prime the iterator.
-            // On subsequent iterations, just increment it.
-            if (it->it_first) {
-                it->it_first = false;
-                it->it_iter = it->it_man->begin();
-            } else {
-                ++it->it_iter;
+        // Once the ready results are exhausted, raise the stored exception
+        // for the element that followed them, or convert more elements.
+        if (it->it_ready_index == it->it_ready_count) {
+            if (it->it_error_type != nullptr) {
+                PyErr_Restore(
+                    std::exchange(it->it_error_type, nullptr),
+                    std::exchange(it->it_error_value, nullptr),
+                    std::exchange(it->it_error_traceback, nullptr)
+                );
+                return nullptr;
             }
+            fill(it);
+        }
 
-            // If the C++ iterator is exhausted, return NULL to
-            // tell Python the iterator is exhausted
-            if (it->it_iter == it->it_man->end()) {
-                return nullptr;
+        // If nothing is ready, the iteration is exhausted or an exception is set
+        if (it->it_ready_index == it->it_ready_count) {
+            return nullptr;
+        }
+        return it->it_ready[it->it_ready_index++];
+    }
+
+    /**
+     * \brief Convert the next chunk of elements into the ready results
+     *
+     * Elements obtained from an iterator are converted one at a time
+     * so that the input is not consumed before the results are requested.
+     * The chunk also ends before any element whose conversion may run
+     * Python code, so that the code is only run when its result is requested.
+     */
+    static void fill(FastnumbersIterator* it) noexcept
+    {
+        const bool read_ahead = it->it_read_ahead && it->it_man->has_direct_access();
+        const Py_ssize_t limit = read_ahead ? CHUNK_SIZE : 1;
+        it->it_ready_index = 0;
+        it->it_ready_count = 0;
+        bool failed = false;
+        while (it->it_ready_count < limit) {
+            PyObject* item = std::exchange(it->it_pending, nullptr);
+            if (item == nullptr) {
+                item = it->it_man->next_item();
+            }
+            if (item == nullptr) {
+                failed = PyErr_Occurred() != nullptr;
+                break;
+            }
+            if (it->it_ready_count > 0 && !is_builtin(item)) {
+                it->it_pending = item;
+                break;
             }
 
-            // Return the current value held in the itertor
-            return *it->it_iter;
-        });
+            // Run inside an exception handler to ensure anything thrown gets
+            // converted into a Python exception.
+            PyObject* value = ExceptionHandler(item).run([it, item]() -> PyObject* {
+                return it->it_man->convert(item);
+            });
+            Py_DECREF(item);
+            if (value == nullptr) {
+                failed = true;
+                break;
+            }
+            it->it_ready[it->it_ready_count++] = value;
+        }
+
+        // An exception after some results were converted is stored
+        // so that it is raised at the position of the failed element.
+        if (failed && it->it_ready_count > 0) {
+            PyErr_Fetch(
+                &it->it_error_type, &it->it_error_value, &it->it_error_traceback
+            );
+        }
+    }
+
+    /// Whether or not an object is converted without running any Python code
+    static bool is_builtin(PyObject* obj) noexcept
+    {
+        return PyUnicode_CheckExact(obj) || PyFloat_CheckExact(obj)
+            || PyLong_CheckExact(obj) || PyBytes_CheckExact(obj)
+            || PyByteArray_CheckExact(obj);
     }
 };
 
@@ -336,7 +404,7 @@ PyTypeObject FastnumbersIteratorType = {
 
 // Implementation for iterating over a collection to populate an iterator
 PyObject* iter_iteration_impl(
-    PyObject* input, std::function<PyObject*(PyObject*)> convert
+    PyObject* input, std::function<PyObject*(PyObject*)> convert, const bool read_ahead
 ) noexcept(false)
 {
     // Create an instance of our iterator object as our iterator type
@@ -346,23 +414,95 @@ PyObject* iter_iteration_impl(
         return nullptr;
     }
 
-    // Add to it the helper for iterating over the Python iterable
-    it->it_man = new IterableManager<PyObject*>(input, convert);
-
-    // Initialize with the end
-    it->it_iter = it->it_man->end();
-
-    // Store the input object over which we are iterating
+    // Store the input object over which we are iterating, and
+    // start with no results ready
     it->it_input = input;
     Py_INCREF(it->it_input);
+    it->it_man = nullptr;
+    it->it_read_ahead = read_ahead;
+    it->it_pending = nullptr;
+    it->it_ready_index = 0;
+    it->it_ready_count = 0;
+    it->it_error_type = nullptr;
+    it->it_error_value = nullptr;
+    it->it_error_traceback = nullptr;
 
-    // Indicate this is the first iteration
-    it->it_first = true;
+    // Add to it the helper for iterating over the Python iterable
+    try {
+        it->it_man = new IterableManager<PyObject*>(input, std::move(convert));
+    } catch (...) {
+        Py_DECREF(it);
+        throw;
+    }
 
     // Return our iterator instance to Python-land
     return (PyObject*)it;
 }
 
+/**
+ * \struct ElementExtractor
+ * \brief Convert a Python object into a C number, favoring an expected type
+ *
+ * Objects of the expected type are read directly, and all others use the
+ * full CTypeExtractor logic. A single type handles all expectations so
+ * that it can be inlined into the iteration over the input. If a cache
+ * is given, repeated strings re-use their earlier parse result.
+ */
+template <typename T, typename OptionsT>
+struct ElementExtractor {
+    /// The type of object that is expected to be seen
+    enum Expected {
+        ANY, ///< Nothing in particular is expected
+        EXACT_FLOAT, ///< Objects of exactly type float are expected
+        EXACT_INT, ///< Objects of exactly type int are expected
+    };
+
+    /// The converter that handles unexpected objects and invalid results
+    CTypeExtractor<T>* m_extractor;
+
+    /// The options of the converter, which may be fixed at compile time
+    OptionsT m_options;
+
+    /// The type of object that is expected to be seen
+    Expected m_expected = ANY;
+
+    /// The parse results of strings seen so far, nullptr to not cache
+    InputCache<RawPayload<T>>* m_cache = nullptr;
+
+    /// Convert the object into a C number, std::nullopt if a Python exception is set
+    std::optional<T> operator()(PyObject* x) const noexcept(false)
+    {
+        if (m_expected == EXACT_FLOAT && PyFloat_CheckExact(x)) {
+            return resolve(checked_cast<T>(PyFloat_AS_DOUBLE(x)), x);
+        } else if (m_expected == EXACT_INT && PyLong_CheckExact(x)) {
+            int overflow = 0;
+            const long long value = PyLong_AsLongLongAndOverflow(x, &overflow);
+            if (overflow == 0) {
+                return resolve(checked_cast<T>(value), x);
+            }
+        }
+        if (m_cache != nullptr) {
+            if (const RawPayload<T>* cached = m_cache->find(x)) {
+                return resolve(*cached, x);
+            }
+            const RawPayload<T> payload = m_extractor->parse_object(x, m_options);
+            m_cache->insert(x, payload);
+            return resolve(payload, x);
+        }
+        return m_extractor->extract_c_number(x, m_options);
+    }
+
+    /// Return the C number, handling it if it is invalid
+    std::optional<T> resolve(const RawPayload<T>& payload, PyObject* x) const
+        noexcept(false)
+    {
+        if (m_extractor->needs_resolution(payload)) {
+            return m_extractor->resolve(payload, x);
+        }
+        return std::get<T>(payload);
+    }
+};
+
 /**
  * \struct ArrayImpl
  * \brief Executor of array population, manages Python memory buffer
@@ -392,9 +532,21 @@ struct ArrayImpl {
     /// Whether or not to allow underscores in strings
     bool m_allow_underscores;
 
+    /// Whether or not to re-use the parse results of repeated strings
+    bool m_cache;
+
+    /// Whether or not to call each user callable once with all its inputs
+    bool m_batch_callables;
+
     /// The base to use when parsing integers
     int m_base;
 
+    /// The calls of user callables to perform once all elements are converted
+    DeferredCalls m_deferred {};
+
+    /// If given, the source of text to parse instead of the input object
+    Tokenizer* m_tokens {};
+
     /// Release the Python memoryview buffer
     ~ArrayImpl() noexcept { PyBuffer_Release(&m_output); }
 
@@ -413,20 +565,322 @@ struct ArrayImpl {
         extractor.set_fail_replacement(m_on_fail);
         extractor.set_overflow_replacement(m_on_overflow);
         extractor.set_type_error_replacement(m_on_type_error);
+        if (m_batch_callables) {
+            extractor.set_deferred_calls(&m_deferred);
+        }
 
-        // Define how we convert each element of the iterable
-        IterableManager<T> iter_man(m_input, [&extractor](PyObject* x) -> T {
-            return extractor.extract_c_number(x);
+        populate(extractor, options);
+
+        // Replace the placeholders with what the user callables return
+        ArrayPopulator pop(m_output, m_output.shape[0]);
+        auto place = [&](Py_ssize_t i, PyObject* x, const char* option, PyObject* y) {
+            const std::optional<T> result
+                = extractor.convert_callable_result(y, x, option);
+            if (result) {
+                pop.place_at(i, *result);
+            }
+            return result.has_value();
+        };
+        if (!m_deferred.call(place)) {
+            throw exception_is_set();
+        }
+    }
+
+    /**
+     * \brief Populate the array by converting each element of the input
+     * \param extractor The converter of each element
+     * \param options The options of the converter
+     */
+    template <typename T>
+    void populate(CTypeExtractor<T>& extractor, const UserOptions& options)
+        noexcept(false)
+    {
+        // Tokens of text are always parsed without creating Python objects
+        if (m_tokens != nullptr) {
+            return with_fixed_options(options, [&](const auto& fixed) {
+                execute_tokens(*m_tokens, extractor, options, fixed);
+            });
+        }
+
+        // Variable-width numpy string arrays can also be parsed in-place
+        StringBuffer strings(m_input);
+        if (strings.valid()) {
+            return with_fixed_options(options, [&](const auto& fixed) {
+                execute_strings(strings, extractor, options, fixed);
+            });
+        }
+
+        // Fixed-width text arrays can be parsed without creating Python objects
+        const TextBuffer text(m_input);
+        if (text.kind() != TextKind::NONE) {
+            return with_fixed_options(options, [&](const auto& fixed) {
+                execute_text(text, extractor, options, fixed);
+            });
+        }
+
+        // Numeric arrays can be converted without creating Python objects
+        const NumericBuffer numbers(m_input);
+        if (numbers.format() != '\0') {
+            return execute_numeric(numbers, extractor);
+        }
+
+        // Otherwise convert each element of the iterable
+        with_fixed_options(options, [&](const auto& fixed) {
+            execute_iterable(extractor, fixed);
         });
+    }
+
+    /**
+     * \brief Populate the array from the elements of an iterable
+     * \param extractor The converter of each element
+     * \param options The options of the converter, which may be a FixedOptions
+     */
+    template <typename T, typename OptionsT>
+    void execute_iterable(
+        CTypeExtractor<T>& extractor, const OptionsT& options
+    ) noexcept(false)
+    {
+        // Repeated strings can re-use the earlier result if requested
+        std::optional<InputCache<RawPayload<T>>> cache;
+        if (m_cache) {
+            cache.emplace();
+        }
+        InputCache<RawPayload<T>>* cache_ptr = cache ? &*cache : nullptr;
+
+        // Define how we convert each element of the iterable
+        using Extractor = ElementExtractor<T, OptionsT>;
+        auto converter = [&](const typename Extractor::Expected expected) {
+            return Extractor { &extractor, options, expected, cache_ptr };
+        };
+        using Manager = IterableManager<std::optional<T>, Extractor>;
+        Manager iter_man(m_input, converter(Extractor::ANY));
 
         // Create a handler for inserting data into the output memory buffer
         ArrayPopulator pop(m_output, iter_man.get_size());
 
-        // Iterate over the input data, convert it, and place it in the output
+        // Data that is already exactly float or int (e.g. it has already
+        // been converted) can be read directly instead of being parsed.
+        // Floats are always invalid for integer types so are not special.
+        const PyTypeObject* type = iter_man.homogeneous_type();
+        if (type == &PyFloat_Type && std::is_floating_point_v<T>) {
+            iter_man.set_converter(converter(Extractor::EXACT_FLOAT));
+        } else if (type == &PyLong_Type) {
+            iter_man.set_converter(converter(Extractor::EXACT_INT));
+        }
+
+        // Iterate over the input data, convert it, and place it in the output.
+        // A failed conversion has set a Python exception that ends the iteration.
         for (const auto& value : iter_man) {
-            pop.place_next(value);
+            if (!value) {
+                throw exception_is_set();
+            }
+            m_deferred.locate(pop.index());
+            pop.place_next(*value);
         }
     }
+
+    /**
+     * \brief Populate the array directly from the records of a fixed-width text array
+     * \param text The fixed-width text array
+     * \param extractor The converter of each record
+     * \param options The options of the converter
+     * \param fixed The same options, which may be a FixedOptions
+     */
+    template <typename T, typename OptionsT>
+    void execute_text(
+        const TextBuffer& text,
+        const CTypeExtractor<T>& extractor,
+        const UserOptions& options,
+        const OptionsT& fixed
+    ) noexcept(false)
+    {
+        ArrayPopulator pop(m_output, text.size());
+        Buffer buffer;
+        auto convert = [&](const Py_ssize_t i) {
+            return extractor.parse(text.parser(i, buffer, options), fixed);
+        };
+        populate_from_buffer(pop, text.size(), extractor, convert, input_item());
+    }
+
+    /**
+     * \brief Populate the array directly from the elements of a numpy string array
+     * \param strings The numpy StringDType array
+     * \param extractor The converter of each element
+     * \param options The options of the converter
+     * \param fixed The same options, which may be a FixedOptions
+     */
+    template <typename T, typename OptionsT>
+    void execute_strings(
+        StringBuffer& strings,
+        const CTypeExtractor<T>& extractor,
+        const UserOptions& options,
+        const OptionsT& fixed
+    ) noexcept(false)
+    {
+        ArrayPopulator pop(m_output, strings.size());
+        Buffer buffer;
+
+        // Null elements are handled like any other non-string (e.g. None).
+        // The GIL is acquired to handle a result, so numpy's allocator lock
+        // is given up first to avoid waiting for the GIL while holding it.
+        auto convert = [&](const Py_ssize_t i) -> RawPayload<T> {
+            const std::optional<AnyParser> parser = strings.parser(i, buffer, options);
+            const RawPayload<T> payload = parser ? extractor.parse(*parser, fixed)
+                                                 : RawPayload<T>(ErrorType::TYPE_ERROR);
+            if (extractor.needs_resolution(payload)) {
+                strings.unlock();
+            }
+            return payload;
+        };
+        populate_from_buffer(pop, strings.size(), extractor, convert, input_item());
+        strings.unlock();
+    }
+
+    /**
+     * \brief Populate the array directly from tokens of text
+     * \param tokens The source of the tokens
+     * \param extractor The converter of each token
+     * \param options The options of the converter
+     * \param fixed The same options, which may be a FixedOptions
+     */
+    template <typename T, typename OptionsT>
+    void execute_tokens(
+        Tokenizer& tokens,
+        const CTypeExtractor<T>& extractor,
+        const UserOptions& options,
+        const OptionsT& fixed
+    ) noexcept(false)
+    {
+        Py_ssize_t size = 0;
+        {
+            GILReleaser gil;
+            size = tokens.count();
+        }
+        ArrayPopulator pop(m_output, size);
+
+        // Tokens are read in order, so an element that needs a Python
+        // object to be handled is always the most recently read token.
+        std::string_view token;
+        auto convert = [&](const Py_ssize_t) {
+            tokens.next(token);
+            return extractor.parse(
+                CharacterParser(token.data(), token.size(), options), fixed
+            );
+        };
+        auto item = [&](const Py_ssize_t) {
+            return PyUnicode_DecodeUTF8(token.data(), token.size(), "surrogateescape");
+        };
+        populate_from_buffer(pop, m_output.shape[0], extractor, convert, item);
+    }
+
+    /// Populate the array directly from the elements of a numeric array
+    template <typename T>
+    void execute_numeric(
+        const NumericBuffer& numbers, const CTypeExtractor<T>& extractor
+    ) noexcept(false)
+    {
+        switch (numbers.format()) {
+        case 'd':
+            return execute_numeric<T, double>(numbers, extractor);
+        case 'f':
+            return execute_numeric<T, float>(numbers, extractor);
+        case 'q':
+            return execute_numeric<T, signed long long>(numbers, extractor);
+        case 'l':
+            return execute_numeric<T, signed long>(numbers, extractor);
+        case 'i':
+            return execute_numeric<T, signed int>(numbers, extractor);
+        case 'h':
+            return execute_numeric<T, signed short>(numbers, extractor);
+        case 'b':
+            return execute_numeric<T, signed char>(numbers, extractor);
+        case 'Q':
+            return execute_numeric<T, unsigned long long>(numbers, extractor);
+        case 'L':
+            return execute_numeric<T, unsigned long>(numbers, extractor);
+        case 'I':
+            return execute_numeric<T, unsigned int>(numbers, extractor);
+        case 'H':
+            return execute_numeric<T, unsigned short>(numbers, extractor);
+        default:
+            return execute_numeric<T, unsigned char>(numbers, extractor);
+        }
+    }
+
+    /// Populate the array from a numeric array with elements of type U
+    template <typename T, typename U>
+    void execute_numeric(
+        const NumericBuffer& numbers, const CTypeExtractor<T>& extractor
+    ) noexcept(false)
+    {
+        ArrayPopulator pop(m_output, numbers.size());
+
+        // If no element needs any error handling, cast them all in bulk
+        {
+            GILReleaser gil;
+            if (numbers.can_cast_all<T, U>(extractor.replaces_nan_or_inf())) {
+                pop.place_all<T>(numbers.data<U>(), numbers.stride(), numbers.size());
+                return;
+            }
+        }
+
+        auto convert = [&](const Py_ssize_t i) {
+            return checked_cast<T>(numbers.get<U>(i));
+        };
+        populate_from_buffer(pop, numbers.size(), extractor, convert, input_item());
+    }
+
+    /**
+     * \brief Populate the array from a buffer without holding the GIL
+     *
+     * The GIL is only held when a Python object is needed to handle
+     * a result, in which case the object is obtained from the item function.
+     *
+     * \param pop The handler for inserting data into the output memory buffer
+     * \param size The number of elements in the input
+     * \param extractor The converter that will handle invalid results
+     * \param convert Function returning the raw result for a given index
+     * \param item Function returning a new reference to the Python object
+     *             for a given index, or nullptr if a Python exception is set
+     */
+    template <typename T, typename Function, typename ItemFunction>
+    void populate_from_buffer(
+        ArrayPopulator& pop,
+        const Py_ssize_t size,
+        const CTypeExtractor<T>& extractor,
+        Function convert,
+        ItemFunction item
+    ) noexcept(false)
+    {
+        GILReleaser gil;
+        for (Py_ssize_t i = 0; i < size; ++i) {
+            const RawPayload<T> payload = convert(i);
+            if (!extractor.needs_resolution(payload)) {
+                pop.place_next(std::get<T>(payload));
+                continue;
+            }
+
+            gil.acquire();
+            PyObject* obj = item(i);
+            if (obj == nullptr) {
+                throw exception_is_set();
+            }
+            const std::optional<T> value = extractor.resolve(payload, obj);
+            Py_DecRef(obj);
+            if (!value) {
+                throw exception_is_set();
+            }
+            m_deferred.locate(pop.index());
+            pop.place_next(*value);
+            gil.release();
+        }
+    }
+
+    /// Function returning the element of the input object at a given index
+    auto input_item() const noexcept
+    {
+        return [this](const Py_ssize_t i) { return PySequence_GetItem(m_input, i); };
+    }
 };
 
 /**
@@ -470,6 +924,46 @@ static inline void validate_not_disallow_str_only_num_only_input(const PyObject*
     }
 }
 
+/**
+ * \brief Obtain the writable buffer of an output array
+ * \param output The object containing the array to populate
+ * \param buf The buffer to fill, which the caller must release
+ * \throws exception_is_set if the object does not support the buffer protocol
+ */
+static inline void get_output_buffer(PyObject* output, Py_buffer& buf) noexcept(false)
+{
+    constexpr auto flags = PyBUF_WRITABLE | PyBUF_STRIDES | PyBUF_FORMAT;
+    if (PyObject_GetBuffer(output, &buf, flags) != 0) {
+        // This should be impossible to encounter because of guards in the python code
+        throw exception_is_set();
+    }
+}
+
+/**
+ * \brief Populate the array with the C number type matching its format
+ * \param impl The executor of array population
+ * \param output The object containing the array to populate
+ */
+static void execute_array(ArrayImpl& impl, PyObject* output) noexcept(false)
+{
+    const Py_buffer& buf = impl.m_output;
+    const bool known = visit_ctype(buf, [&impl](auto value) {
+        impl.execute<decltype(value)>();
+    });
+    if (known) {
+        return;
+    }
+
+    // This should be impossible to encounter because of guards in the python code
+    PyErr_Format(
+        PyExc_TypeError,
+        "Unknown buffer format '%s' for object '%.200R'",
+        buf.format,
+        output
+    );
+    throw exception_is_set();
+}
+
 // Implementation for iterating over a collection to populate an array
 void array_impl(
     PyObject* input,
@@ -480,6 +974,8 @@ void array_impl(
     PyObject* on_overflow,
     PyObject* on_type_error,
     bool allow_underscores,
+    bool cache,
+    bool batch_callables,
     int base
 ) noexcept(false)
 {
@@ -492,54 +988,712 @@ void array_impl(
 
     // Extract the underlying buffer data from the output object
     Py_buffer buf { nullptr, nullptr };
-    constexpr auto flags = PyBUF_WRITABLE | PyBUF_STRIDES | PyBUF_FORMAT;
-    if (PyObject_GetBuffer(output, &buf, flags) != 0) {
-        // This should be impossible to encounter because of guards in the python code
-        throw exception_is_set();
-    }
+    get_output_buffer(output, buf);
 
     // Pass on all arguments to the actual implementation
     // NOTE: This will manage the buffer object for us
     ArrayImpl impl {
         input, buf, inf, nan, on_fail, on_overflow, on_type_error, allow_underscores,
-        base,
+        cache, batch_callables, base,
     };
+    execute_array(impl, output);
+}
 
-    // Use the format to determine the code path to execute
-    // Attempt to order this if-branch by anticipated frequency of use
-    const std::string_view format(buf.format == nullptr ? "<NULL>" : buf.format);
-    if (format == "d") {
-        return impl.execute<double>();
-    } else if (format == "l") {
-        return impl.execute<signed long>();
-    } else if (format == "q") {
-        return impl.execute<signed long long>();
-    } else if (format == "i") {
-        return impl.execute<signed int>();
-    } else if (format == "f") {
-        return impl.execute<float>();
-    } else if (format == "L") {
-        return impl.execute<unsigned long>();
-    } else if (format == "Q") {
-        return impl.execute<unsigned long long>();
-    } else if (format == "I") {
-        return impl.execute<unsigned int>();
-    } else if (format == "h") {
-        return impl.execute<signed short>();
-    } else if (format == "b") {
-        return impl.execute<signed char>();
-    } else if (format == "H") {
-        return impl.execute<unsigned short>();
-    } else if (format == "B") {
-        return impl.execute<unsigned char>();
+// Implementation for parsing tokens of text to populate an array
+void tokens_array_impl(
+    Tokenizer& tokens,
+    PyObject* output,
+    PyObject* inf,
+    PyObject* nan,
+    PyObject* on_fail,
+    PyObject* on_overflow,
+    bool allow_underscores,
+    int base
+) noexcept(false)
+{
+    // Ensure the given parameters are valid.
+    validate_not_disallow_str_only_num_only_input(inf);
+    validate_not_disallow_str_only_num_only_input(nan);
+    validate_not_allow_disallow_str_only_num_only_input(on_fail);
+    validate_not_allow_disallow_str_only_num_only_input(on_overflow);
+
+    // Extract the underlying buffer data from the output object
+    Py_buffer buf { nullptr, nullptr };
+    get_output_buffer(output, buf);
+
+    // Tokens are always text, so there can be no type errors
+    // NOTE: This will manage the buffer object for us
+    ArrayImpl impl {
+        nullptr, buf, inf, nan, on_fail, on_overflow, Selectors::RAISE,
+        allow_underscores, false, false, base, {}, &tokens,
+    };
+    execute_array(impl, output);
+}
+
+// Create the filler of one array of a multi-array conversion
+std::unique_ptr<Column> make_column(
+    PyObject* output,
+    PyObject* mask,
+    Py_ssize_t rows,
+    const Replacements& replacements,
+    bool allow_underscores,
+    int base
+) noexcept(false)
+{
+    // Ensure the given parameters are valid.
+    validate_not_disallow_str_only_num_only_input(replacements.inf);
+    validate_not_disallow_str_only_num_only_input(replacements.nan);
+    validate_not_allow_disallow_str_only_num_only_input(replacements.on_fail);
+    validate_not_allow_disallow_str_only_num_only_input(replacements.on_overflow);
+    validate_not_allow_disallow_str_only_num_only_input(replacements.on_type_error);
+
+    UserOptions options;
+    options.set_base(base);
+    options.set_underscores_allowed(allow_underscores);
+
+    auto buffer = std::make_unique<WritableBuffer>(output);
+    std::unique_ptr<Column> column;
+    visit_ctype(buffer->view(), [&](auto value) {
+        using T = decltype(value);
+        column = std::make_unique<TypedColumn<T>>(
+            std::move(buffer), mask, rows, options, replacements
+        );
+    });
+    if (!column) {
+        // This should be impossible to encounter because of guards in the python code
+        PyErr_Format(
+            PyExc_TypeError,
+            "Unknown buffer format '%s' for object '%.200R'",
+            buffer->view().format,
+            output
+        );
+        throw exception_is_set();
     }
+    return column;
+}
 
-    // This should be impossible to encounter because of guards in the python code
-    PyErr_Format(
-        PyExc_TypeError,
-        "Unknown buffer format '%s' for object '%.200R'",
-        buf.format,
-        output
+/**
+ * \brief Fill a row of a column from text, creating a Python object if needed
+ * \param column The column to fill
+ * \param text The text to parse
+ * \param make_item Function giving the text as it is to be shown to the user
+ * \param row The row to fill
+ * \param gil The GIL releaser to acquire the GIL with if needed
+ */
+template <typename ItemText>
+static inline void fill_from_text(
+    Column& column,
+    const std::string_view text,
+    ItemText make_item,
+    const Py_ssize_t row,
+    GILReleaser& gil
+) noexcept(false)
+{
+    if (column.parse(text, row)) {
+        return;
+    }
+
+    gil.acquire();
+    const auto item_text = make_item();
+    PyObject* item = PyUnicode_DecodeUTF8(
+        item_text.data(), static_cast<Py_ssize_t>(item_text.size()), "surrogateescape"
     );
-    throw exception_is_set();
-}
\ No newline at end of file
+    if (item == nullptr) {
+        throw exception_is_set();
+    }
+    const bool ok = column.resolve(text, item, row);
+    Py_DecRef(item);
+    if (!ok) {
+        throw exception_is_set();
+    }
+    gil.release();
+}
+
+/**
+ * \brief Fill a row of a column from a field, creating a Python object if needed
+ * \param column The column to fill
+ * \param reader The reader the field came from
+ * \param field The field to parse
+ * \param row The row to fill
+ * \param gil The GIL releaser to acquire the GIL with if needed
+ */
+static inline void fill_from_field(
+    Column& column,
+    const DelimitedReader& reader,
+    const DelimitedReader::Field& field,
+    const Py_ssize_t row,
+    GILReleaser& gil
+) noexcept(false)
+{
+    fill_from_text(
+        column, field.text, [&]() { return reader.unescape(field); }, row, gil
+    );
+}
+
+// Implementation for parsing the fields of delimited text into arrays
+void delimited_impl(
+    DelimitedReader& reader, Py_ssize_t rows, const std::vector<Column*>& columns
+) noexcept(false)
+{
+    GILReleaser gil;
+    const DelimitedReader::Field missing { std::string_view(""), false };
+    DelimitedReader::Field field;
+    for (Py_ssize_t row = 0; row < rows && reader.next_record(); ++row) {
+        std::size_t index = 0;
+        for (; index < columns.size() && reader.next_field(field); ++index) {
+            if (columns[index] != nullptr) {
+                fill_from_field(*columns[index], reader, field, row, gil);
+            }
+        }
+
+        // Fields missing from the end of the record are treated as empty
+        for (; index < columns.size(); ++index) {
+            if (columns[index] != nullptr) {
+                fill_from_field(*columns[index], reader, missing, row, gil);
+            }
+        }
+    }
+}
+
+// Implementation for parsing the fields of fixed-width text into arrays
+void fixed_width_impl(
+    FixedWidthReader& reader,
+    Py_ssize_t rows,
+    const std::vector<std::pair<std::size_t, std::size_t>>& ranges,
+    const std::vector<Column*>& columns
+) noexcept(false)
+{
+    GILReleaser gil;
+    std::string_view record;
+    for (Py_ssize_t row = 0; row < rows && reader.next(record); ++row) {
+        for (std::size_t i = 0; i < columns.size(); ++i) {
+            // A field beyond the end of a short record is truncated or empty
+            const auto [start, end] = ranges[i];
+            const std::string_view field = start < record.size()
+                ? record.substr(start, end - start)
+                : std::string_view("");
+            fill_from_text(*columns[i], field, [&]() { return field; }, row, gil);
+        }
+    }
+}
+
+/**
+ * \brief Convert the fields of one row into the columns
+ * \param input The row, which must be a sequence
+ * \param row The index of the row
+ * \param columns The column to fill from each field
+ * \return false if a Python exception is set
+ */
+static bool
+convert_row(PyObject* input, const Py_ssize_t row, const std::vector<Column*>& columns)
+    noexcept(false)
+{
+    PyObject* record = PySequence_Fast(input, "each row must be a sequence");
+    if (record == nullptr) {
+        return false;
+    }
+    const Py_ssize_t size = PySequence_Fast_GET_SIZE(record);
+    bool ok = size == static_cast<Py_ssize_t>(columns.size());
+    if (!ok) {
+        PyErr_Format(
+            PyExc_ValueError,
+            "Row %zd has %zd fields, expected %zd",
+            row,
+            size,
+            static_cast<Py_ssize_t>(columns.size())
+        );
+    }
+    PyObject** fields = PySequence_Fast_ITEMS(record);
+    for (Py_ssize_t i = 0; ok && i < size; ++i) {
+        ok = columns[static_cast<std::size_t>(i)]->convert(fields[i], row);
+    }
+    Py_DECREF(record);
+    return ok;
+}
+
+// Implementation for converting the fields of rows of Python objects into arrays
+void rows_impl(PyObject* input, const std::vector<Column*>& columns) noexcept(false)
+{
+    PyObject* rows = PySequence_Fast(input, "'input' must be iterable");
+    if (rows == nullptr) {
+        throw exception_is_set();
+    }
+    bool ok = true;
+    const Py_ssize_t size = PySequence_Fast_GET_SIZE(rows);
+    for (Py_ssize_t row = 0; ok && row < size; ++row) {
+        ok = convert_row(PySequence_Fast_GET_ITEM(rows, row), row, columns);
+    }
+    Py_DECREF(rows);
+    if (!ok) {
+        throw exception_is_set();
+    }
+}
+
+// Implementation for parsing the numbers of a JSON array into arrays
+void json_impl(
+    JsonArrayReader& reader, Py_ssize_t rows, const std::vector<Column*>& columns
+) noexcept(false)
+{
+    GILReleaser gil;
+    const std::size_t ncolumns = columns.size();
+    const bool valid = reader.read([&](const Py_ssize_t row,
+                                       const Py_ssize_t column,
+                                       const std::string_view text,
+                                       const bool null) {
+        // The shape is only checked once the whole array has been read
+        if (row >= rows || static_cast<std::size_t>(column) >= ncolumns) {
+            return;
+        }
+        Column& output = *columns[static_cast<std::size_t>(column)];
+        if (!null) {
+            fill_from_text(output, text, [text]() { return text; }, row, gil);
+            return;
+        }
+
+        // Null is treated as None would be by try_array, i.e. a type error
+        gil.acquire();
+        if (!output.convert(Py_None, row)) {
+            throw exception_is_set();
+        }
+        gil.release();
+    });
+    gil.acquire();
+
+    if (!valid) {
+        PyErr_Format(
+            PyExc_ValueError,
+            "Invalid JSON number array at position %zd: %s",
+            reader.position(),
+            reader.error()
+        );
+        throw exception_is_set();
+    }
+    const Py_ssize_t width = reader.nested() ? reader.columns() : 1;
+    const bool same_shape = ncolumns == 0
+        ? width == 0
+        : reader.rows() == rows && static_cast<std::size_t>(width) == ncolumns;
+    if (!same_shape) {
+        throw fastnumbers_exception("The JSON array does not match the outputs");
+    }
+}
+
+/**
+ * \brief Convert the ASCII text of a number found within text into a Python number
+ * \param text The text of the number, as written by NaturalText::to_ascii
+ * \param real Whether to return a float rather than an int
+ * \return The new reference to the number, or nullptr if a Python exception is set
+ */
+static PyObject* natural_number(const std::string& text, const bool real) noexcept
+{
+    const char* start = text.data();
+    const char* end = start + text.size();
+    bool error = false;
+    if (real) {
+        return PyFloat_FromDouble(parse_float<double>(start, end, error));
+    }
+    bool overflow = false;
+    const long long value = parse_int<long long>(start, end, 10, error, overflow);
+    if (!overflow) {
+        return PyLong_FromLongLong(value);
+    }
+    return PyLong_FromString(text.c_str(), nullptr, 10);
+}
+
+/**
+ * \brief Casefold a str for case-insensitive sorting
+ * \param input The str to casefold
+ * \return A new reference to the casefolded str, or nullptr if a Python
+ *         exception is set
+ */
+static PyObject* natural_casefold(PyObject* input) noexcept
+{
+    if (!PyUnicode_IS_ASCII(input)) {
+        return PyObject_CallMethod(input, "casefold", nullptr);
+    }
+
+    // For ASCII, casefolding is simply lowercasing letters
+    const Py_ssize_t size = PyUnicode_GET_LENGTH(input);
+    PyObject* result = PyUnicode_New(size, 127);
+    if (result == nullptr) {
+        return nullptr;
+    }
+    const Py_UCS1* source = PyUnicode_1BYTE_DATA(input);
+    Py_UCS1* target = PyUnicode_1BYTE_DATA(result);
+    for (Py_ssize_t i = 0; i < size; ++i) {
+        const Py_UCS1 c = source[i];
+        target[i] = c >= 'A' && c <= 'Z' ? static_cast<Py_UCS1>(c | 32) : c;
+    }
+    return result;
+}
+
+/**
+ * \brief Split a str into alternating text and numbers for natural sorting
+ * \param input The str to split
+ * \param options How numbers are found
+ * \param buffer Scratch space for the text of numbers
+ * \return A new reference to the tuple of the chunks, or nullptr if a Python
+ *         exception is set
+ */
+static PyObject* natural_chunks(
+    PyObject* input, const NaturalOptions& options, std::string& buffer
+) noexcept(false)
+{
+    // Text and numbers alternate, starting with text, so empty text
+    // separates adjacent numbers and starts a str starting with a number
+    const NaturalText text(input, options);
+    PyObject* chunks = PyList_New(0);
+    if (chunks == nullptr) {
+        return nullptr;
+    }
+    auto append = [chunks](PyObject* chunk) -> bool {
+        const bool ok = chunk != nullptr && PyList_Append(chunks, chunk) == 0;
+        Py_XDECREF(chunk);
+        return ok;
+    };
+
+    bool ok = true;
+    Py_ssize_t length = 0;
+    Py_ssize_t pos = 0;
+    while (ok && pos < text.size()) {
+        const Py_ssize_t start = text.find_number(pos, length);
+        ok = append(PyUnicode_Substring(input, pos, start));
+        if (start == text.size()) {
+            break;
+        }
+        text.to_ascii(start, length, buffer);
+        ok = ok && append(natural_number(buffer, options.real));
+        pos = start + length;
+    }
+
+    PyObject* result = ok ? PyList_AsTuple(chunks) : nullptr;
+    Py_DECREF(chunks);
+    return result;
+}
+
+/**
+ * \brief Create the natural sort key of an object
+ * \param input The object to create the key of
+ * \param options How numbers are found
+ * \param casefold Whether or not to casefold text
+ * \param buffer Scratch space for the text of numbers
+ * \return A new reference to the key, or nullptr if a Python exception is set
+ */
+static PyObject* natural_key(
+    PyObject* input,
+    const NaturalOptions& options,
+    const bool casefold,
+    std::string& buffer
+) noexcept(false)
+{
+    // Numbers sort as if they were a str containing only that number
+    if (PyLong_Check(input) || PyFloat_Check(input)) {
+        return Py_BuildValue("(sO)", "", input);
+    }
+    if (!PyUnicode_Check(input)) {
+        PyErr_Format(
+            PyExc_TypeError,
+            "natural sort keys can only be made from str, int or float, not %.200s",
+            Py_TYPE(input)->tp_name
+        );
+        return nullptr;
+    }
+    if (!casefold) {
+        return natural_chunks(input, options, buffer);
+    }
+    PyObject* folded = natural_casefold(input);
+    if (folded == nullptr) {
+        return nullptr;
+    }
+    PyObject* result = natural_chunks(folded, options, buffer);
+    Py_DECREF(folded);
+    return result;
+}
+
+// Implementation for creating the natural sort key of an object
+PyObject* natsort_key_impl(
+    PyObject* input, const NaturalOptions& options, const bool casefold
+) noexcept(false)
+{
+    std::string buffer;
+    PyObject* key = natural_key(input, options, casefold, buffer);
+    if (key == nullptr) {
+        throw exception_is_set();
+    }
+    return key;
+}
+
+/**
+ * \brief Create the natural sort key of each object of a sequence
+ * \param items The sequence, as given by PySequence_Fast
+ * \param options How numbers are found
+ * \param casefold Whether or not to casefold text
+ * \return A new reference to the list of keys, or nullptr if a Python
+ *         exception is set
+ */
+static PyObject* natural_keys(
+    PyObject* items, const NaturalOptions& options, const bool casefold
+) noexcept(false)
+{
+    const Py_ssize_t size = PySequence_Fast_GET_SIZE(items);
+    PyObject* keys = PyList_New(size);
+    std::string buffer;
+    for (Py_ssize_t i = 0; keys != nullptr && i < size; ++i) {
+        PyObject* item = PySequence_Fast_GET_ITEM(items, i);
+        PyObject* key = natural_key(item, options, casefold, buffer);
+        if (key == nullptr) {
+            Py_CLEAR(keys);
+        } else {
+            PyList_SET_ITEM(keys, i, key);
+        }
+    }
+    return keys;
+}
+
+// Implementation for creating the natural sort keys of each object of an iterable
+PyObject* natsort_keys_impl(
+    PyObject* input, const NaturalOptions& options, const bool casefold
+) noexcept(false)
+{
+    PyObject* items = PySequence_Fast(input, "'input' must be iterable");
+    if (items == nullptr) {
+        throw exception_is_set();
+    }
+    PyObject* keys = natural_keys(items, options, casefold);
+    Py_DECREF(items);
+    if (keys == nullptr) {
+        throw exception_is_set();
+    }
+    return keys;
+}
+
+/**
+ * \brief The text of a str to compare in natural order
+ * \param input The str
+ * \param casefold Whether or not to casefold the text
+ * \return A new reference to the text, or nullptr if a Python exception is set
+ */
+static PyObject* natural_text(PyObject* input, const bool casefold) noexcept
+{
+    if (casefold) {
+        return natural_casefold(input);
+    }
+    Py_INCREF(input);
+    return input;
+}
+
+/**
+ * \brief Find the natural order of the objects of a list
+ *
+ * If every object is a str, they are compared in place without creating
+ * keys, and without holding the GIL. Otherwise, they are compared by key.
+ *
+ * \param values The list of objects to order
+ * \param reverse Whether or not to order from last to first
+ * \param options How numbers are found
+ * \param casefold Whether or not to casefold text
+ * \param order Where to store the positions of the objects in order
+ * \return false if a Python exception is set
+ */
+static bool natural_order(
+    PyObject* values,
+    const bool reverse,
+    const NaturalOptions& options,
+    const bool casefold,
+    std::vector<Py_ssize_t>& order
+) noexcept(false)
+{
+    const Py_ssize_t size = PyList_GET_SIZE(values);
+    order.resize(static_cast<std::size_t>(size));
+    std::iota(order.begin(), order.end(), 0);
+
+    // A merge sort of the positions, which like Python's sort is stable
+    // in reverse too (i.e. equal objects keep their order)
+    auto sort = [&](auto less) {
+        std::stable_sort(order.begin(), order.end(), [&](Py_ssize_t i, Py_ssize_t j) {
+            return reverse ? less(j, i) : less(i, j);
+        });
+    };
+
+    bool all_text = true;
+    for (Py_ssize_t i = 0; all_text && i < size; ++i) {
+        all_text = PyUnicode_Check(PyList_GET_ITEM(values, i));
+    }
+    if (!all_text) {
+        PyObject* keys = natural_keys(values, options, casefold);
+        if (keys == nullptr) {
+            return false;
+        }
+        bool failed = false;
+        sort([&](Py_ssize_t i, Py_ssize_t j) {
+            const int less = failed ? 0
+                                    : PyObject_RichCompareBool(
+                                        PyList_GET_ITEM(keys, i),
+                                        PyList_GET_ITEM(keys, j),
+                                        Py_LT
+                                    );
+            failed = less < 0;
+            return less > 0;
+        });
+        Py_DECREF(keys);
+        return !failed;
+    }
+
+    // The texts are kept alive by this list while the GIL is released
+    PyObject* texts = PyList_New(size);
+    std::vector<NaturalText> views;
+    views.reserve(static_cast<std::size_t>(size));
+    for (Py_ssize_t i = 0; texts != nullptr && i < size; ++i) {
+        PyObject* text = natural_text(PyList_GET_ITEM(values, i), casefold);
+        if (text == nullptr) {
+            Py_CLEAR(texts);
+        } else {
+            PyList_SET_ITEM(texts, i, text);
+            views.emplace_back(text, options);
+        }
+    }
+    if (texts == nullptr) {
+        return false;
+    }
+    {
+        GILReleaser gil;
+        NaturalComparator comparator(options);
+        sort([&](Py_ssize_t i, Py_ssize_t j) {
+            return comparator.compare(views[i], views[j]) < 0;
+        });
+    }
+    Py_DECREF(texts);
+    return true;
+}
+
+// Implementation for comparing two objects in natural order
+PyObject* natcmp_impl(
+    PyObject* a, PyObject* b, const NaturalOptions& options, const bool casefold
+) noexcept(false)
+{
+    // Numbers are compared through their keys
+    if (!PyUnicode_Check(a) || !PyUnicode_Check(b)) {
+        PyObject* keys = PyTuple_Pack(2, a, b);
+        PyObject* pair = keys == nullptr ? nullptr
+                                         : natural_keys(keys, options, casefold);
+        Py_XDECREF(keys);
+        if (pair == nullptr) {
+            throw exception_is_set();
+        }
+        PyObject* key_a = PyList_GET_ITEM(pair, 0);
+        PyObject* key_b = PyList_GET_ITEM(pair, 1);
+        const int less = PyObject_RichCompareBool(key_a, key_b, Py_LT);
+        const int greater
+            = less != 0 ? 0 : PyObject_RichCompareBool(key_a, key_b, Py_GT);
+        Py_DECREF(pair);
+        if (less < 0 || greater < 0) {
+            throw exception_is_set();
+        }
+        return PyLong_FromLong(greater - less);
+    }
+
+    PyObject* text_a = natural_text(a, casefold);
+    PyObject* text_b = text_a == nullptr ? nullptr : natural_text(b, casefold);
+    if (text_b == nullptr) {
+        Py_XDECREF(text_a);
+        throw exception_is_set();
+    }
+    NaturalComparator comparator(options);
+    const int result = comparator.compare(
+        NaturalText(text_a, options), NaturalText(text_b, options)
+    );
+    Py_DECREF(text_a);
+    Py_DECREF(text_b);
+    return PyLong_FromLong(result < 0 ? -1 : result > 0 ? 1 : 0);
+}
+
+// Implementation for sorting the objects of an iterable in natural order
+PyObject* natsorted_impl(
+    PyObject* input,
+    PyObject* key,
+    const bool reverse,
+    const NaturalOptions& options,
+    const bool casefold
+) noexcept(false)
+{
+    PyObject* items = PySequence_List(input);
+    if (items == nullptr) {
+        throw exception_is_set();
+    }
+    const Py_ssize_t size = PyList_GET_SIZE(items);
+
+    // The objects compared are the results of the key function, if any
+    PyObject* values = items;
+    if (key == Py_None) {
+        Py_INCREF(values);
+    } else {
+        values = PyList_New(size);
+        for (Py_ssize_t i = 0; values != nullptr && i < size; ++i) {
+            PyObject* item = PyList_GET_ITEM(items, i);
+            PyObject* value = PyObject_CallFunctionObjArgs(key, item, nullptr);
+            if (value == nullptr) {
+                Py_CLEAR(values);
+            } else {
+                PyList_SET_ITEM(values, i, value);
+            }
+        }
+    }
+
+    std::vector<Py_ssize_t> order;
+    const bool ordered = values != nullptr
+        && natural_order(values, reverse, options, casefold, order);
+    Py_XDECREF(values);
+    PyObject* result = ordered ? PyList_New(size) : nullptr;
+    for (Py_ssize_t i = 0; result != nullptr && i < size; ++i) {
+        PyObject* item = PyList_GET_ITEM(items, order[static_cast<std::size_t>(i)]);
+        Py_INCREF(item);
+        PyList_SET_ITEM(result, i, item);
+    }
+    Py_DECREF(items);
+    if (result == nullptr) {
+        throw exception_is_set();
+    }
+    return result;
+}
+
+// Implementation for finding the numbers within text
+PyObject* find_numbers_impl(
+    PyObject* input, const UserType ntype, NaturalOptions options, const bool offsets
+) noexcept(false)
+{
+    if (!PyUnicode_Check(input)) {
+        PyErr_Format(
+            PyExc_TypeError,
+            "find_numbers can only search str, not %.200s",
+            Py_TYPE(input)->tp_name
+        );
+        throw exception_is_set();
+    }
+    options.real = ntype != UserType::INT;
+    const NaturalText text(input, options);
+    PyObject* numbers = PyList_New(0);
+    if (numbers == nullptr) {
+        throw exception_is_set();
+    }
+
+    std::string buffer;
+    Py_ssize_t length = 0;
+    Py_ssize_t pos = text.find_number(0, length);
+    for (; pos < text.size(); pos = text.find_number(pos + length, length)) {
+        text.to_ascii(pos, length, buffer);
+
+        // A real is only a float if it has a decimal point or exponent
+        const bool as_float = ntype == UserType::FLOAT
+            || (ntype == UserType::REAL && buffer.find_first_of(".eE") != buffer.npos);
+        PyObject* number = natural_number(buffer, as_float);
+        if (number != nullptr && offsets) {
+            number = Py_BuildValue("(Nnn)", number, pos, pos + length);
+        }
+        const bool ok = number != nullptr && PyList_Append(numbers, number) == 0;
+        Py_XDECREF(number);
+        if (!ok) {
+            Py_DECREF(numbers);
+            throw exception_is_set();
+        }
+    }
+    return numbers;
+}
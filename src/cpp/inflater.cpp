@@ -0,0 +1,267 @@
+/*
+ * Decompress gzip or zlib compressed input in a worker thread
+ */
+#include <algorithm>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <string_view>
+#include <thread>
+
+#include <Python.h>
+
+#include "fastnumbers/exception.hpp"
+#include "fastnumbers/gil.hpp"
+#include "fastnumbers/inflater.hpp"
+
+#ifdef FASTNUMBERS_ZLIB
+#define ZLIB_CONST
+#include <zlib.h>
+#endif
+
+/// The largest block size, so that sizes always fit in zlib's counters
+static constexpr std::size_t MAX_BLOCK_SIZE = std::size_t(1) << 30;
+
+/// Whether or not data starts with a gzip or zlib header
+static bool is_compressed(const std::string_view data) noexcept
+{
+    if (data.size() < 2) {
+        return false;
+    }
+    const unsigned first = static_cast<unsigned char>(data[0]);
+    const unsigned second = static_cast<unsigned char>(data[1]);
+    const bool is_gzip = first == 0x1F && second == 0x8B;
+    const bool is_zlib = (first & 0x0F) == 8 && ((first << 8) | second) % 31 == 0;
+    return is_gzip || is_zlib;
+}
+
+Inflater::Inflater(PyObject* read, const std::size_t block_size, const bool threads)
+    : m_read(read)
+    , m_block_size(std::min(block_size, MAX_BLOCK_SIZE))
+    , m_threads(threads)
+    , m_stream(nullptr)
+    , m_input()
+    , m_has_input(false)
+    , m_unread()
+    , m_started(false)
+    , m_finished(false)
+    , m_stream_ended(false)
+    , m_status(Status::NEED_INPUT)
+    , m_error(nullptr)
+    , m_blocks()
+    , m_lengths()
+    , m_filling(0)
+    , m_mutex()
+    , m_changed()
+    , m_pending(false)
+    , m_quit(false)
+    , m_worker()
+{
+#ifdef FASTNUMBERS_ZLIB
+    // The blocks are only allocated here, so that the worker never allocates
+    try {
+        m_blocks[0].reset(new char[m_block_size]);
+        m_blocks[1].reset(new char[m_block_size]);
+    } catch (const std::bad_alloc&) {
+        PyErr_NoMemory();
+        throw exception_is_set();
+    }
+
+    m_stream.reset(new z_stream_s());
+    // Adding 32 to the window bits accepts either a gzip or a zlib header
+    if (inflateInit2(m_stream.get(), MAX_WBITS | 32) != Z_OK) {
+        throw std::bad_alloc();
+    }
+#else
+    PyErr_SetString(
+        PyExc_RuntimeError,
+        "fastnumbers was built without zlib, so cannot decompress input"
+    );
+    throw exception_is_set();
+#endif
+}
+
+Inflater::~Inflater() noexcept
+{
+    if (m_worker.joinable()) {
+        {
+            const std::lock_guard<std::mutex> lock(m_mutex);
+            m_quit = true;
+        }
+        m_changed.notify_all();
+        GILReleaser gil;
+        m_worker.join();
+    }
+    if (m_has_input) {
+        PyBuffer_Release(&m_input);
+    }
+}
+
+void Inflater::StreamDeleter::operator()(z_stream_s* stream) const noexcept
+{
+#ifdef FASTNUMBERS_ZLIB
+    inflateEnd(stream);
+    delete stream;
+#else
+    // A stream is never created without zlib
+    static_cast<void>(stream);
+#endif
+}
+
+std::optional<std::string_view> Inflater::next()
+{
+    while (!m_finished) {
+        wait();
+        const std::size_t ready = m_filling;
+
+        if (m_status == Status::CORRUPT) {
+            PyErr_Format(
+                PyExc_ValueError,
+                "The compressed input is corrupt: %s",
+                m_error
+            );
+            throw exception_is_set();
+        }
+        if (m_status != Status::FULL && !read()) {
+            if (m_status == Status::NEED_INPUT && m_started) {
+                PyErr_SetString(
+                    PyExc_EOFError,
+                    "Compressed input ended before the end-of-stream marker "
+                    "was reached"
+                );
+                throw exception_is_set();
+            }
+            m_finished = true;
+        }
+
+        // Decompress the next block while the caller handles this one
+        if (!m_finished) {
+            m_filling = 1 - ready;
+            start();
+        }
+        if (m_lengths[ready] > 0) {
+            return std::string_view(m_blocks[ready].get(), m_lengths[ready]);
+        }
+    }
+    return std::nullopt;
+}
+
+bool Inflater::read()
+{
+    if (m_has_input) {
+        PyBuffer_Release(&m_input);
+        m_has_input = false;
+    }
+
+    // Both headers are at least two bytes
+    const Py_ssize_t size = static_cast<Py_ssize_t>(
+        m_started ? m_block_size : std::max<std::size_t>(m_block_size, 2)
+    );
+    PyObject* data = PyObject_CallFunction(m_read, "n", size);
+    if (data == nullptr) {
+        throw exception_is_set();
+    }
+    const int failed = PyObject_GetBuffer(data, &m_input, PyBUF_SIMPLE);
+    Py_DECREF(data);
+    if (failed != 0) {
+        throw exception_is_set();
+    }
+    m_has_input = true;
+
+    const std::string_view input(
+        static_cast<const char*>(m_input.buf), static_cast<std::size_t>(m_input.len)
+    );
+    if (input.empty()) {
+        return false;
+    }
+    if (!m_started && !is_compressed(input)) {
+        throw fastnumbers_exception("The input is not gzip or zlib compressed");
+    }
+    m_started = true;
+    m_unread = input;
+    return true;
+}
+
+void Inflater::start()
+{
+    if (!m_threads) {
+        GILReleaser gil;
+        inflate();
+        return;
+    }
+    if (!m_worker.joinable()) {
+        m_worker = std::thread(&Inflater::work, this);
+    }
+    {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        m_pending = true;
+    }
+    m_changed.notify_all();
+}
+
+void Inflater::wait() noexcept
+{
+    GILReleaser gil(m_threads);
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_changed.wait(lock, [this] { return !m_pending; });
+}
+
+void Inflater::inflate() noexcept
+{
+#ifdef FASTNUMBERS_ZLIB
+    z_stream_s& stream = *m_stream;
+    stream.next_out = reinterpret_cast<Bytef*>(m_blocks[m_filling].get());
+    stream.avail_out = static_cast<uInt>(m_block_size);
+
+    m_status = Status::FULL;
+    while (stream.avail_out > 0) {
+        if (stream.avail_in == 0 && !m_unread.empty()) {
+            const std::size_t size = std::min(m_unread.size(), MAX_BLOCK_SIZE);
+            stream.next_in = reinterpret_cast<const Bytef*>(m_unread.data());
+            stream.avail_in = static_cast<uInt>(size);
+            m_unread.remove_prefix(size);
+        }
+
+        // Like the gzip module, another stream may follow the end of one
+        if (m_stream_ended) {
+            if (stream.avail_in == 0) {
+                m_status = Status::STREAM_END;
+                break;
+            }
+            inflateReset(&stream);
+            m_stream_ended = false;
+        }
+
+        const int result = ::inflate(&stream, Z_NO_FLUSH);
+        if (result == Z_STREAM_END) {
+            m_stream_ended = true;
+        } else if (result == Z_BUF_ERROR) {
+            // No progress is possible until there is more input
+            m_status = Status::NEED_INPUT;
+            break;
+        } else if (result != Z_OK) {
+            m_status = Status::CORRUPT;
+            m_error = stream.msg != nullptr ? stream.msg : "invalid compressed data";
+            break;
+        }
+    }
+    m_lengths[m_filling] = m_block_size - stream.avail_out;
+#endif
+}
+
+void Inflater::work() noexcept
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        m_changed.wait(lock, [this] { return m_pending || m_quit; });
+        if (!m_pending) {
+            return;
+        }
+        lock.unlock();
+        inflate();
+        lock.lock();
+        m_pending = false;
+        m_changed.notify_all();
+    }
+}
@@ -0,0 +1,134 @@
+/*
+ * Recognize numpy scalar types and read their values directly
+ */
+#include <cstdint>
+#include <cstring>
+
+#include <Python.h>
+
+#include "fastnumbers/numpy_scalar.hpp"
+
+/// The memory layout of a numpy scalar holding a value of type T
+template <typename T>
+struct ScalarLayout {
+    PyObject_HEAD T obval;
+};
+
+/// A numpy scalar type and the information needed to read its value
+struct ScalarType {
+    PyTypeObject* type;
+    NumpyScalarKind kind;
+    Py_ssize_t itemsize;
+};
+
+/// The numpy type codes for the scalar types that are recognized
+static constexpr char SCALAR_CODES[] = "bhilqBHILQfd";
+
+/// The number of scalar types that are recognized
+static constexpr std::size_t N_SCALAR_TYPES = sizeof(SCALAR_CODES) - 1;
+
+/// The cached numpy scalar types
+static ScalarType scalar_types[N_SCALAR_TYPES];
+
+/// The number of valid entries in scalar_types
+static std::size_t n_scalar_types = 0;
+
+void NumpyScalar::load_types() noexcept
+{
+    // Nothing that happens here may disturb an exception the caller has set
+    PyObject *exc_type, *exc_value, *exc_traceback;
+    PyErr_Fetch(&exc_type, &exc_value, &exc_traceback);
+
+    // The Python package imports numpy whenever it is installed, so
+    // importing it here adds no cost. If it is missing, nothing is loaded.
+    PyObject* numpy = PyImport_ImportModule("numpy");
+    for (std::size_t i = 0; numpy != nullptr && i < N_SCALAR_TYPES; ++i) {
+        const char code = SCALAR_CODES[i];
+        PyObject* dtype = PyObject_CallMethod(numpy, "dtype", "C", code);
+        PyObject* type = dtype ? PyObject_GetAttrString(dtype, "type") : nullptr;
+        PyObject* size = dtype ? PyObject_GetAttrString(dtype, "itemsize") : nullptr;
+        const Py_ssize_t itemsize = size ? PyLong_AsSsize_t(size) : -1;
+        Py_XDECREF(dtype);
+        Py_XDECREF(size);
+        if (type == nullptr || !PyType_Check(type) || itemsize <= 0) {
+            Py_XDECREF(type);
+            PyErr_Clear(); // Only clears the lookup's own error
+            continue;
+        }
+
+        // The type reference is intentionally kept for the life of the module
+        const NumpyScalarKind kind = code == 'f' || code == 'd'
+            ? NumpyScalarKind::FLOAT
+            : (code >= 'a' ? NumpyScalarKind::SIGNED : NumpyScalarKind::UNSIGNED);
+        scalar_types[n_scalar_types++] = { (PyTypeObject*)type, kind, itemsize };
+    }
+    Py_XDECREF(numpy);
+
+    // Discard any error from the import and put back the caller's
+    PyErr_Restore(exc_type, exc_value, exc_traceback);
+}
+
+/// Read the value of type T stored in a numpy scalar
+template <typename T>
+static T read_value(PyObject* obj) noexcept
+{
+    return reinterpret_cast<const ScalarLayout<T>*>(obj)->obval;
+}
+
+NumpyScalar NumpyScalar::read(PyObject* obj) noexcept
+{
+    NumpyScalar scalar;
+
+    // Only numpy types are of interest - use the type name as a cheap filter
+    // so that the table of types is only searched if it will be useful.
+    PyTypeObject* type = Py_TYPE(obj);
+    if (std::strncmp(type->tp_name, "numpy.", 6) != 0) {
+        return scalar;
+    }
+
+    for (std::size_t i = 0; i < n_scalar_types; ++i) {
+        if (scalar_types[i].type != type) {
+            continue;
+        }
+        const Py_ssize_t itemsize = scalar_types[i].itemsize;
+        switch (scalar_types[i].kind) {
+        case NumpyScalarKind::SIGNED:
+            if (itemsize == 1) {
+                scalar.m_signed = read_value<std::int8_t>(obj);
+            } else if (itemsize == 2) {
+                scalar.m_signed = read_value<std::int16_t>(obj);
+            } else if (itemsize == 4) {
+                scalar.m_signed = read_value<std::int32_t>(obj);
+            } else if (itemsize == 8) {
+                scalar.m_signed = read_value<std::int64_t>(obj);
+            } else {
+                return scalar;
+            }
+            break;
+        case NumpyScalarKind::UNSIGNED:
+            if (itemsize == 1) {
+                scalar.m_unsigned = read_value<std::uint8_t>(obj);
+            } else if (itemsize == 2) {
+                scalar.m_unsigned = read_value<std::uint16_t>(obj);
+            } else if (itemsize == 4) {
+                scalar.m_unsigned = read_value<std::uint32_t>(obj);
+            } else if (itemsize == 8) {
+                scalar.m_unsigned = read_value<std::uint64_t>(obj);
+            } else {
+                return scalar;
+            }
+            break;
+        default:
+            if (itemsize == sizeof(float)) {
+                scalar.m_float = static_cast<double>(read_value<float>(obj));
+            } else if (itemsize == sizeof(double)) {
+                scalar.m_float = read_value<double>(obj);
+            } else {
+                return scalar;
+            }
+        }
+        scalar.m_kind = scalar_types[i].kind;
+        break;
+    }
+    return scalar;
+}
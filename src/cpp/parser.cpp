@@ -57,18 +57,18 @@ CharacterParser::CharacterParser(
     // Store the end point of the character array
     const char* end = m_end_orig;
 
-    // Strip leading whitespace
-    while (is_whitespace(*m_start)) {
-        m_start += 1;
-    }
+    // Strip leading whitespace.
+    // The data is not guaranteed to be nul-terminated (e.g. records of
+    // a fixed-width array) so we must never read past the end.
+    consume_whitespace(m_start, end);
 
     // Strip trailing whitespace.
     strip_trailing_whitespace(m_start, end);
 
     // Remove the sign if present and remember what it represents
-    if (*m_start == '+') {
+    if (m_start != end && *m_start == '+') {
         m_start += 1;
-    } else if (*m_start == '-') {
+    } else if (m_start != end && *m_start == '-') {
         m_start += 1;
         set_negative();
     }
@@ -77,7 +77,7 @@ CharacterParser::CharacterParser(
     // Two or more signs is illegal - let's treat it as such.
     // Reset the start to before the first sign.
     // All parsers will treat this as illegal now.
-    if (is_sign(*m_start)) {
+    if (m_start != end && is_sign(*m_start)) {
         m_start -= 1;
         set_negative(false);
     }
@@ -0,0 +1,204 @@
+/*
+ * Read the elements of numpy StringDType arrays without the GIL
+ */
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+#include <Python.h>
+
+#include "fastnumbers/string_buffer.hpp"
+
+/// An unpacked element of a StringDType array (npy_static_string)
+struct StaticString {
+    std::size_t size;
+    const char* buf;
+};
+
+/// The leading fields of a numpy array, which are part of numpy's stable ABI
+struct ArrayFields {
+    PyObject_HEAD char* data;
+    int nd;
+    Py_intptr_t* dimensions;
+    Py_intptr_t* strides;
+    PyObject* base;
+    PyObject* descr;
+};
+
+/// Signature of NpyString_load
+using LoadFunction
+    = int (*)(npy_string_allocator*, const void*, StaticString*) noexcept;
+
+/// Signature of NpyString_acquire_allocator
+using AcquireFunction = npy_string_allocator* (*)(const PyObject*) noexcept;
+
+/// Signature of NpyString_release_allocator
+using ReleaseFunction = void (*)(npy_string_allocator*) noexcept;
+
+/// Signature of PyArray_GetNDArrayCFeatureVersion
+using VersionFunction = unsigned (*)() noexcept;
+
+/// The numpy C API version in which the NpyString functions were added
+static constexpr unsigned NPY_2_0_API_VERSION = 0x00000012;
+
+/// Indices of the functions used here in the numpy C API table
+enum ArrayApiIndex : std::size_t {
+    NDARRAY_TYPE = 2,
+    FEATURE_VERSION = 211,
+    STRING_LOAD = 313,
+    ACQUIRE_ALLOCATOR = 316,
+    RELEASE_ALLOCATOR = 318,
+};
+
+/// The numpy.ndarray type, or nullptr if the API was not found
+static PyTypeObject* ndarray_type = nullptr;
+
+/// The numpy.dtypes.StringDType type, or nullptr if the API was not found
+static PyTypeObject* string_dtype_type = nullptr;
+
+/// The NpyString functions
+static LoadFunction string_load = nullptr;
+static AcquireFunction acquire_allocator = nullptr;
+static ReleaseFunction release_allocator = nullptr;
+
+/// Find the numpy C API table, or return nullptr
+static void** find_array_api() noexcept
+{
+    PyObject* multiarray = PyImport_ImportModule("numpy._core._multiarray_umath");
+    PyObject* capsule
+        = multiarray ? PyObject_GetAttrString(multiarray, "_ARRAY_API") : nullptr;
+    void** api = nullptr;
+    if (capsule != nullptr && PyCapsule_CheckExact(capsule)) {
+        api = static_cast<void**>(PyCapsule_GetPointer(capsule, nullptr));
+    }
+    Py_XDECREF(capsule);
+    Py_XDECREF(multiarray);
+    if (api == nullptr) {
+        return nullptr;
+    }
+
+    // The NpyString functions only exist from numpy 2
+    auto version = reinterpret_cast<VersionFunction>(api[FEATURE_VERSION]);
+    return version() >= NPY_2_0_API_VERSION ? api : nullptr;
+}
+
+void StringBuffer::load_api() noexcept
+{
+    // Nothing that happens here may disturb an exception the caller has set
+    PyObject *exc_type, *exc_value, *exc_traceback;
+    PyErr_Fetch(&exc_type, &exc_value, &exc_traceback);
+
+    void** api = find_array_api();
+    PyObject* dtypes = api ? PyImport_ImportModule("numpy.dtypes") : nullptr;
+    PyObject* dtype = dtypes ? PyObject_GetAttrString(dtypes, "StringDType") : nullptr;
+    Py_XDECREF(dtypes);
+
+    // The type references are intentionally kept for the life of the module
+    if (dtype != nullptr && PyType_Check(dtype)) {
+        ndarray_type = static_cast<PyTypeObject*>(api[NDARRAY_TYPE]);
+        string_dtype_type = reinterpret_cast<PyTypeObject*>(dtype);
+        string_load = reinterpret_cast<LoadFunction>(api[STRING_LOAD]);
+        acquire_allocator = reinterpret_cast<AcquireFunction>(api[ACQUIRE_ALLOCATOR]);
+        release_allocator = reinterpret_cast<ReleaseFunction>(api[RELEASE_ALLOCATOR]);
+    } else {
+        Py_XDECREF(dtype);
+    }
+
+    // Discard any error from the lookup and put back the caller's
+    PyErr_Restore(exc_type, exc_value, exc_traceback);
+}
+
+StringBuffer::StringBuffer(PyObject* obj) noexcept
+    : m_valid(false)
+    , m_data(nullptr)
+    , m_stride(0)
+    , m_size(0)
+    , m_descr(nullptr)
+    , m_allocator(nullptr)
+    , m_ucs4()
+{
+    if (string_dtype_type == nullptr || !PyObject_TypeCheck(obj, ndarray_type)) {
+        return;
+    }
+    const ArrayFields* array = reinterpret_cast<const ArrayFields*>(obj);
+    if (array->nd != 1 || Py_TYPE(array->descr) != string_dtype_type) {
+        return;
+    }
+    m_valid = true;
+    m_data = array->data;
+    m_stride = static_cast<Py_ssize_t>(array->strides[0]);
+    m_size = static_cast<Py_ssize_t>(array->dimensions[0]);
+    m_descr = array->descr;
+}
+
+/**
+ * \brief Decode UTF-8 data into UCS4 code points
+ *
+ * Numpy only stores valid UTF-8 in StringDType arrays, so the data
+ * is not validated.
+ *
+ * \param data The UTF-8 data
+ * \param len The number of bytes in data
+ * \param out The storage for the code points, which is replaced
+ */
+static void decode_utf8(
+    const unsigned char* data, const std::size_t len, std::vector<Py_UCS4>& out
+) noexcept(false)
+{
+    out.clear();
+    for (std::size_t i = 0; i < len;) {
+        const unsigned char lead = data[i];
+        std::size_t extra = 0;
+        Py_UCS4 code = lead;
+        if (lead >= 0xF0) {
+            extra = 3;
+            code = lead & 0x07U;
+        } else if (lead >= 0xE0) {
+            extra = 2;
+            code = lead & 0x0FU;
+        } else if (lead >= 0xC0) {
+            extra = 1;
+            code = lead & 0x1FU;
+        }
+        i += 1;
+        for (; extra > 0 && i < len; --extra, ++i) {
+            code = (code << 6) | (data[i] & 0x3FU);
+        }
+        out.push_back(code);
+    }
+}
+
+std::optional<AnyParser> StringBuffer::parser(
+    const Py_ssize_t index, Buffer& buffer, const UserOptions& options
+) noexcept(false)
+{
+    if (m_allocator == nullptr) {
+        m_allocator = acquire_allocator(m_descr);
+    }
+
+    // A null element (1) or one that cannot be read (-1) has no text
+    StaticString text { 0, nullptr };
+    if (string_load(m_allocator, m_data + index * m_stride, &text) != 0) {
+        return std::nullopt;
+    }
+
+    // ASCII text can be parsed in-place, anything else is decoded first
+    const unsigned char* data = reinterpret_cast<const unsigned char*>(text.buf);
+    std::size_t i = 0;
+    while (i < text.size && data[i] < 0x80) {
+        i += 1;
+    }
+    if (i == text.size) {
+        return CharacterParser(text.buf, text.size, options);
+    }
+    decode_utf8(data, text.size, m_ucs4);
+    return extract_parser(m_ucs4.data(), m_ucs4.size(), buffer, options);
+}
+
+void StringBuffer::unlock() noexcept
+{
+    if (m_allocator != nullptr) {
+        release_allocator(m_allocator);
+        m_allocator = nullptr;
+    }
+}
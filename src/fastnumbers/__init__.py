@@ -1,3 +1,6 @@
+import contextlib
+import mmap
+import os
 from typing import TYPE_CHECKING
 
 from .fastnumbers import (
@@ -7,6 +10,8 @@ from .fastnumbers import (
     NUMBER_ONLY,
     RAISE,
     STRING_ONLY,
+    Converter,
+    TextStream as _TextStream,
     __version__,
     array as _array,
     check_float,
@@ -17,14 +22,24 @@ from .fastnumbers import (
     fast_forceint,
     fast_int,
     fast_real,
+    find_numbers,
     float,
     int,
     isfloat,
     isint,
     isintlike,
     isreal,
+    natcmp,
+    natsort_key,
+    natsort_keys,
+    natsorted,
+    parse_delimited as _parse_delimited,
+    parse_fixed as _parse_fixed,
+    parse_json as _parse_json,
+    parse_text as _parse_text,
     query_type,
     real,
+    rows as _rows,
     try_float,
     try_forceint,
     try_int,
@@ -90,6 +105,8 @@ if TYPE_CHECKING:
         on_type_error: RAISE_T | int | CallToInt = RAISE,
         base: int = 10,
         allow_underscores: bool = False,
+        cache: bool = False,
+        batch_callables: bool = False,
     ) -> np.ndarray[IntT]:
         ...
 
@@ -106,6 +123,8 @@ if TYPE_CHECKING:
         on_type_error: RAISE_T | int | float | CallToInt | CallToFloat = RAISE,
         base: int = 10,
         allow_underscores: bool = False,
+        cache: bool = False,
+        batch_callables: bool = False,
     ) -> np.ndarray[FloatT]:
         ...
 
@@ -121,6 +140,8 @@ if TYPE_CHECKING:
         on_type_error: RAISE_T | int | CallToInt = RAISE,
         base: int = 10,
         allow_underscores: bool = False,
+        cache: bool = False,
+        batch_callables: bool = False,
     ) -> None:
         ...
 
@@ -136,6 +157,8 @@ if TYPE_CHECKING:
         on_type_error: RAISE_T | int | float | CallToInt | CallToFloat = RAISE,
         base: int = 10,
         allow_underscores: bool = False,
+        cache: bool = False,
+        batch_callables: bool = False,
     ) -> None:
         ...
 
@@ -151,6 +174,8 @@ if TYPE_CHECKING:
         on_type_error: RAISE_T | int | CallToInt = RAISE,
         base: int = 10,
         allow_underscores: bool = False,
+        cache: bool = False,
+        batch_callables: bool = False,
     ) -> None:
         ...
 
@@ -166,9 +191,47 @@ if TYPE_CHECKING:
         on_type_error: RAISE_T | int | float | CallToInt | CallToFloat = RAISE,
         base: int = 10,
         allow_underscores: bool = False,
+        cache: bool = False,
+        batch_callables: bool = False,
     ) -> None:
         ...
 
+    @overload
+    def parse_file(
+        path: str | os.PathLike[str] | os.PathLike[bytes],
+        sep: bytes | str = b"\n",
+        *,
+        dtype: IntT,
+        skip: int = 0,
+        usecol: int | None = None,
+        delimiter: bytes | str = b",",
+        inf: ALLOWED_T | int | CallToInt = ALLOWED,
+        nan: ALLOWED_T | int | CallToInt = ALLOWED,
+        on_fail: RAISE_T | int | CallToInt = RAISE,
+        on_overflow: RAISE_T | int | CallToInt = RAISE,
+        base: int = 10,
+        allow_underscores: bool = False,
+    ) -> np.ndarray[IntT]:
+        ...
+
+    @overload
+    def parse_file(
+        path: str | os.PathLike[str] | os.PathLike[bytes],
+        sep: bytes | str = b"\n",
+        *,
+        dtype: FloatT = np.float64,
+        skip: int = 0,
+        usecol: int | None = None,
+        delimiter: bytes | str = b",",
+        inf: ALLOWED_T | int | float | CallToInt | CallToFloat = ALLOWED,
+        nan: ALLOWED_T | int | float | CallToInt | CallToFloat = ALLOWED,
+        on_fail: RAISE_T | int | float | CallToInt | CallToFloat = RAISE,
+        on_overflow: RAISE_T | int | float | CallToInt | CallToFloat = RAISE,
+        base: int = 10,
+        allow_underscores: bool = False,
+    ) -> np.ndarray[FloatT]:
+        ...
+
 
 def try_array(input, output=None, *, dtype=None, **kwargs):
     """
@@ -227,6 +290,18 @@ def try_array(input, output=None, *, dtype=None, **kwargs):
         or *float* (see PEP 515 for details on what is and is not allowed). You can
         enable that behavior by setting this option to *True* - the default is
         *False*.
+    cache : bool, optional
+        If *True*, the result of converting each *str* is remembered so that
+        repeated strings are not parsed again, which is faster for data with few
+        distinct values. The cache turns itself off if few strings are repeated.
+        The default is *False*.
+    batch_callables : bool, optional
+        If *True*, each callable given to ``inf``, ``nan``, ``on_fail``,
+        ``on_overflow`` or ``on_type_error`` is called only once, after all other
+        elements are converted, with a *list* of all the inputs it applies to.
+        It must return an iterable of the same length containing the values to
+        use for those inputs. This is useful for fallback parsers that are
+        vectorised. The default is *False*.
 
     Returns
     -------
@@ -319,13 +394,860 @@ def try_array(input, output=None, *, dtype=None, **kwargs):
         return output
 
 
+def try_rows(
+    input,
+    dtypes=None,
+    *,
+    masks=False,
+    inf=ALLOWED,
+    nan=ALLOWED,
+    on_fail=RAISE,
+    on_overflow=RAISE,
+    on_type_error=RAISE,
+    **kwargs,
+):
+    """
+    Quickly convert an iterable of rows (e.g. from a database cursor) into arrays.
+
+    Each row is a sequence (e.g. a *tuple*) with one value for each field.
+    The rows are traversed once, and each value is converted directly into
+    the array for its field, as by :func:`try_array`. This avoids transposing
+    the rows into columns first.
+
+    Parameters
+    ----------
+    input
+        The iterable of rows to convert. Every row must have the same number
+        of fields.
+    dtypes : optional
+        Either a list with the *dtype* of each field (or a single *dtype* for
+        every field), in which case a list of arrays is returned, or a numpy
+        structured *dtype*, in which case a structured array is returned.
+        Each *dtype* must be of integral or float type. The default is
+        ``np.float64`` for each field of the first row.
+    masks : bool, optional
+        If *True*, also return a boolean validity mask for each field that
+        is *False* for each row in which the field could not be converted
+        (i.e. for which ``on_fail``, ``on_overflow`` or ``on_type_error`` was
+        used, such as for *None*). The default is *False*.
+    inf, nan, on_fail, on_overflow, on_type_error : optional
+        Control how values are converted - see :func:`try_array`. Each may
+        instead be a list with one value for each field.
+    base, allow_underscores : optional
+        Control how values are converted. See :func:`try_array`.
+
+    Returns
+    -------
+    list
+        The array of each field, if ``dtypes`` is not a structured *dtype*.
+    ndarray
+        The structured array, if ``dtypes`` is a structured *dtype*.
+    tuple
+        If ``masks`` is *True*, the above and a *list* of the validity mask
+        of each field.
+
+    Raises
+    ------
+    RuntimeError
+        If *numpy* is not installed.
+    ValueError
+        If a row does not have one value for each field.
+    TypeError, OverflowError, ValueError
+        If a value cannot be converted, as for :func:`try_array`.
+
+    Examples
+    --------
+
+        >>> from fastnumbers import try_rows
+        >>> import numpy as np
+        >>> rows = [(1, "2.5"), ("3", None)]
+        >>> ids, prices = try_rows(rows, [np.int64, np.float64], on_type_error=0)
+        >>> ids
+        array([1, 3])
+        >>> prices
+        array([2.5, 0. ])
+        >>> try_rows(rows, np.dtype([("id", "i4"), ("price", "f8")]), on_type_error=0)
+        array([(1, 2.5), (3, 0. )], dtype=[('id', '<i4'), ('price', '<f8')])
+
+    """
+    if not has_numpy:
+        raise RuntimeError("fastnumbers.try_rows requires numpy to be installed")
+
+    rows = input if isinstance(input, (list, tuple)) else list(input)
+    if isinstance(dtypes, np.dtype) and dtypes.names is not None:
+        result = np.empty(len(rows), dtype=dtypes)
+        outputs = [result[name] for name in dtypes.names]
+    else:
+        count = len(dtypes) if isinstance(dtypes, (list, tuple)) else None
+        if count is None:
+            count = len(rows[0]) if rows else 0
+        dtypes = _per_column("dtypes", dtypes, count)
+        outputs = [np.empty(len(rows), dtype=d or np.float64) for d in dtypes]
+        result = outputs
+
+    fields = len(outputs)
+    validity = [np.ones(len(rows), dtype=bool) if masks else None for _ in outputs]
+    _rows(
+        rows,
+        outputs,
+        masks=validity,
+        inf=_per_column("inf", inf, fields),
+        nan=_per_column("nan", nan, fields),
+        on_fail=_per_column("on_fail", on_fail, fields),
+        on_overflow=_per_column("on_overflow", on_overflow, fields),
+        on_type_error=_per_column("on_type_error", on_type_error, fields),
+        **kwargs,
+    )
+    if masks:
+        return result, validity
+    return result
+
+
+def _as_separator(sep):
+    """Separators may be given as str for convenience, but are bytes."""
+    return sep.encode() if isinstance(sep, str) else sep
+
+
+@contextlib.contextmanager
+def _text_of(source):
+    """Give the bytes of a file (memory-mapped if possible) or bytes-like object."""
+    if not isinstance(source, (str, os.PathLike)):
+        yield source
+        return
+
+    with open(source, "rb") as fp:
+        try:
+            text = mmap.mmap(fp.fileno(), 0, access=mmap.ACCESS_READ)
+        except (ValueError, OSError):
+            # Empty files and special files (e.g. pipes) cannot be mapped
+            text = fp.read()
+    try:
+        yield text
+    finally:
+        if isinstance(text, mmap.mmap):
+            text.close()
+
+
+def parse_file(
+    path, sep=b"\n", *, dtype=None, skip=0, usecol=None, delimiter=b",", **kwargs
+):
+    """
+    Quickly parse the numbers in a text file into an array.
+
+    The file is memory-mapped and split into tokens without creating a
+    Python object for each one, and each token is parsed directly into
+    a ``numpy.ndarray``. Whitespace surrounding each token is ignored.
+
+    Parameters
+    ----------
+    path
+        The path of the local text file to parse.
+    sep : optional
+        The separator between the records of the file. The default is
+        ``b"\\n"``, i.e. one number per line (``b"\\r\\n"`` line endings are
+        also handled because the ``b"\\r"`` is whitespace). Each record is
+        a token, except that a final empty record (i.e. the file ends with
+        ``sep``) is ignored. May be *bytes* or *str*.
+    dtype : optional
+        The *dtype* of the returned ``ndarray``. The default is ``np.float64``.
+        The *dtype* must be of integral or float type.
+    skip : int, optional
+        The number of records at the start of the file to ignore (e.g. a
+        header line). The default is 0.
+    usecol : int, optional
+        If given, each record is split into fields on ``delimiter`` and only
+        the field at this (zero-based) index is parsed. A record without
+        this field gives an empty token. The default is *None*, which
+        parses each whole record.
+    delimiter : optional
+        The separator between the fields of a record, only used if ``usecol``
+        is given. The default is ``b","``. May be *bytes* or *str*.
+    inf : optional
+        Control how INF is interpreted/handled. See :func:`try_array`.
+    nan : optional
+        Control how NaN is interpreted/handled. See :func:`try_array`.
+    on_fail : optional
+        Control what happens when a token cannot be converted. See
+        :func:`try_array`. Callables are given the token as a *str*.
+    on_overflow : optional
+        Control what happens when a token does not fit in the *dtype*.
+        See :func:`try_array`.
+    base : int, optional
+        The integer base to use when the *dtype* is integral. See :func:`try_array`.
+    allow_underscores : bool, optional
+        Whether or not to allow underscores in numbers. See :func:`try_array`.
+
+    Returns
+    -------
+    ndarray
+        The parsed numbers, one for each token.
+
+    Raises
+    ------
+    RuntimeError
+        If *numpy* is not installed.
+    OverflowError
+        If a token cannot fit into the desired *dtype* and ``on_overflow`` is
+        set to *RAISE*.
+    ValueError
+        If a token cannot be converted and ``on_fail`` is set to *RAISE*.
+
+    Examples
+    --------
+
+        >>> from fastnumbers import parse_file
+        >>> import tempfile, os
+        >>> with tempfile.NamedTemporaryFile("w", delete=False) as fp:
+        ...     _ = fp.write("a,b\\n1,5\\n2,6\\n")
+        >>> parse_file(fp.name, skip=1, usecol=1)
+        array([5., 6.])
+        >>> os.remove(fp.name)
+
+    """
+    if not has_numpy:
+        raise RuntimeError("fastnumbers.parse_file requires numpy to be installed")
+
+    tokens = {
+        "sep": _as_separator(sep),
+        "delimiter": _as_separator(delimiter),
+        "usecol": usecol,
+        "skip": skip,
+    }
+    with _text_of(path) as text:
+        # Count the tokens to create an array of the right size, then fill it.
+        output = np.empty(_parse_text(text, None, **tokens), dtype=dtype or np.float64)
+        _parse_text(text, output, **tokens, **kwargs)
+    return output
+
+
+class StreamParser:
+    """
+    Incrementally parse the numbers in text that arrives in chunks.
+
+    This is for text from sources such as sockets, pipes, or decompressors
+    that deliver bytes in arbitrary chunks. Each chunk is given to
+    :meth:`feed`, which parses all the complete records so far without
+    creating a Python object for each number, and keeps any incomplete
+    trailing record until the next chunk arrives. Once the text is
+    exhausted, :meth:`finish` parses whatever remains.
+
+    The parsing options are the same as those of :func:`parse_file`.
+
+    Parameters
+    ----------
+    dtype : optional
+        The *dtype* of the returned arrays. The default is ``np.float64``.
+    sep : optional
+        The separator between records. The default is ``b"\\n"``.
+    skip : int, optional
+        The number of records at the start of the text to ignore.
+    usecol : int, optional
+        If given, only parse this field of each record.
+    delimiter : optional
+        The separator between the fields of a record. The default is ``b","``.
+    collect : bool, optional
+        If *False* (the default), :meth:`feed` and :meth:`finish` return the
+        numbers parsed from the text given since the last call. If *True*,
+        the numbers are instead appended to a growing internal buffer,
+        :meth:`feed` returns *None*, and :meth:`finish` returns all numbers.
+    inf, nan, on_fail, on_overflow, base, allow_underscores : optional
+        Control how tokens are converted. See :func:`try_array`.
+
+    Examples
+    --------
+
+        >>> from fastnumbers import StreamParser
+        >>> parser = StreamParser()
+        >>> parser.feed(b"1.5\\n2")
+        array([1.5])
+        >>> parser.feed(b"5\\n3")
+        array([25.])
+        >>> parser.finish()
+        array([3.])
+
+    """
+
+    def __init__(
+        self,
+        dtype=None,
+        sep=b"\n",
+        *,
+        skip=0,
+        usecol=None,
+        delimiter=b",",
+        collect=False,
+        **kwargs,
+    ):
+        if not has_numpy:
+            raise RuntimeError(
+                "fastnumbers.StreamParser requires numpy to be installed"
+            )
+        self._dtype = np.dtype(dtype or np.float64)
+        tokens = {
+            "sep": _as_separator(sep),
+            "delimiter": _as_separator(delimiter),
+            "usecol": usecol,
+            "skip": skip,
+        }
+        self._collect = collect
+
+        # Check all options now instead of on the first chunk
+        _parse_text(b"", np.empty(0, self._dtype), **tokens, **kwargs)
+
+        # The incomplete record at the end of the text is kept natively, so
+        # that feeding many small chunks does not copy the text repeatedly
+        self._stream = _TextStream(**tokens, **kwargs)
+        self._reset()
+
+    def _reset(self):
+        self._stream.reset()
+        self._buffer = np.empty(0, self._dtype)
+        self._size = 0
+
+    def _room(self, length):
+        """Give the space for the next length collected values."""
+        # Grow geometrically so that appending is amortised constant time
+        if self._size + length > len(self._buffer):
+            capacity = max(self._size + length, 2 * len(self._buffer))
+            buffer = np.empty(capacity, self._dtype)
+            buffer[: self._size] = self._buffer[: self._size]
+            self._buffer = buffer
+        return self._buffer[self._size : self._size + length]
+
+    def _claim(self, length):
+        """Give the space for the next length values, counting them as collected."""
+        output = self._room(length)
+        self._size += length
+        return output
+
+    def _parse(self, length):
+        """Parse the staged records, returning the values if not collecting."""
+        if length is None:
+            return None if self._collect else np.empty(0, self._dtype)
+
+        if self._collect:
+            output = self._room(length)
+        else:
+            output = np.empty(length, self._dtype)
+
+        # The records are only consumed once they were parsed successfully
+        self._stream.parse(output)
+        if self._collect:
+            self._size += length
+            return None
+        return output
+
+    def feed(self, chunk):
+        """
+        Parse the complete records of the text given so far.
+
+        If an exception is raised, the chunk is not consumed.
+
+        Parameters
+        ----------
+        chunk
+            The next bytes-like chunk of text.
+
+        Returns
+        -------
+        ndarray
+            The numbers parsed from the complete records, or *None* if
+            ``collect`` is *True*.
+
+        """
+        return self._parse(self._stream.feed(chunk))
+
+    def finish(self):
+        """
+        Parse any remaining incomplete record and reset the parser.
+
+        Returns
+        -------
+        ndarray
+            The numbers parsed from the remaining text, or all the numbers
+            parsed since the parser was created or last finished if ``collect``
+            is *True*.
+
+        """
+        result = self._parse(self._stream.end())
+        if self._collect:
+            # The buffer is never shared until now, so spare capacity can be freed
+            result = self._buffer
+            result.resize(self._size, refcheck=False)
+        self._reset()
+        return result
+
+
+def _per_column(name, value, count):
+    """Give one value per column, where a list or tuple already has one per column."""
+    if not isinstance(value, (list, tuple)):
+        return [value] * count
+    if len(value) != count:
+        raise ValueError(
+            f"'{name}' must have one item for each of the {count} columns, "
+            f"not {len(value)}"
+        )
+    return list(value)
+
+
+def parse_columns(
+    source,
+    sep=",",
+    *,
+    dtypes=None,
+    usecols=None,
+    quotechar='"',
+    header=False,
+    skip=0,
+    masks=False,
+    inf=ALLOWED,
+    nan=ALLOWED,
+    on_fail=RAISE,
+    on_overflow=RAISE,
+    **kwargs,
+):
+    """
+    Quickly parse the numeric columns of delimited text (e.g. CSV) into arrays.
+
+    The text is read in a single pass, and each field of each record is
+    parsed directly into the array for its column, without creating a
+    Python object for each number. Whitespace surrounding each field is
+    ignored, as are blank lines.
+
+    Parameters
+    ----------
+    source
+        The path of a local text file (which is memory-mapped), or a
+        bytes-like object containing the text.
+    sep : optional
+        The single character separating the fields of a record. The default
+        is ``","``. Use ``"\\t"`` for tab-separated text. May be *str* or *bytes*.
+    dtypes : optional
+        The *dtype* of the returned arrays, either one for all columns or
+        a list with one for each column. The default is ``np.float64``.
+    usecols : optional
+        The columns to parse, as a list of (zero-based) field indices or,
+        if ``header`` is *True*, field names. The default is *None*, which
+        parses every field of the first record.
+    quotechar : optional
+        The character that may surround a field, in which case the field
+        may contain ``sep`` or newlines. Within a quoted field, a doubled
+        ``quotechar`` stands for a single one. *None* disables quoting.
+        The default is ``'"'``.
+    header : bool, optional
+        Whether or not the first record (after those skipped) contains the
+        names of the fields. The default is *False*.
+    skip : int, optional
+        The number of records at the start of the text to ignore. The
+        default is 0.
+    masks : bool, optional
+        If *True*, also return a boolean validity mask for each column that
+        is *False* for each field that could not be converted (i.e. for which
+        ``on_fail`` or ``on_overflow`` was used). The default is *False*.
+    inf, nan, on_fail, on_overflow : optional
+        Control how fields are converted - see :func:`try_array`. Each may
+        instead be a list with one value for each column. A field missing
+        from the end of a record is treated as an empty field, which fails.
+    base, allow_underscores : optional
+        Control how fields are converted. See :func:`try_array`.
+
+    Returns
+    -------
+    dict
+        The array of each column, keyed by the field name if ``header`` is
+        *True*, or the field index otherwise.
+    tuple
+        If ``masks`` is *True*, the above *dict* and a *dict* of the validity
+        mask of each column.
+
+    Raises
+    ------
+    RuntimeError
+        If *numpy* is not installed.
+    OverflowError
+        If a field cannot fit into the desired *dtype* and ``on_overflow`` is
+        set to *RAISE*.
+    ValueError
+        If a field cannot be converted and ``on_fail`` is set to *RAISE*.
+
+    Examples
+    --------
+
+        >>> from fastnumbers import parse_columns
+        >>> import numpy as np
+        >>> columns = parse_columns(b'x,y,z\\n1,"2",a\\n3,4,b\\n', header=True,
+        ...                         usecols=["x", "y"], dtypes=[np.int64, np.float64])
+        >>> columns["x"]
+        array([1, 3])
+        >>> columns["y"]
+        array([2., 4.])
+
+    """
+    if not has_numpy:
+        raise RuntimeError("fastnumbers.parse_columns requires numpy to be installed")
+
+    reader = {
+        "sep": _as_separator(sep),
+        "quotechar": None if quotechar is None else _as_separator(quotechar),
+        "skip": skip,
+        "header": header,
+    }
+    with _text_of(source) as text:
+        names, nfields, rows = _parse_delimited(text, None, **reader)
+
+        # Locate the fields of the requested columns
+        fields = list(range(nfields)) if usecols is None else []
+        for column in usecols or []:
+            if not isinstance(column, str):
+                fields.append(column)
+            elif names is None:
+                raise ValueError(f"Cannot use column name {column!r} without a header")
+            elif column not in names:
+                raise ValueError(f"Column {column!r} is not in the header {names}")
+            else:
+                fields.append(names.index(column))
+
+        dtypes = _per_column("dtypes", dtypes, len(fields))
+        outputs = [np.empty(rows, dtype=d or np.float64) for d in dtypes]
+        validity = [np.ones(rows, dtype=bool) if masks else None for _ in fields]
+        _parse_delimited(
+            text,
+            outputs,
+            **reader,
+            fields=fields,
+            masks=validity,
+            inf=_per_column("inf", inf, len(fields)),
+            nan=_per_column("nan", nan, len(fields)),
+            on_fail=_per_column("on_fail", on_fail, len(fields)),
+            on_overflow=_per_column("on_overflow", on_overflow, len(fields)),
+            **kwargs,
+        )
+
+    keys = [names[f] if names and f < len(names) else f for f in fields]
+    if masks:
+        return dict(zip(keys, outputs)), dict(zip(keys, validity))
+    return dict(zip(keys, outputs))
+
+
+def parse_fixed_width(
+    source,
+    colspecs,
+    *,
+    dtypes=None,
+    record_length=None,
+    skip=0,
+    masks=False,
+    inf=ALLOWED,
+    nan=ALLOWED,
+    on_fail=RAISE,
+    on_overflow=RAISE,
+    **kwargs,
+):
+    """
+    Quickly parse the numeric fields of fixed-width text into arrays.
+
+    Each field is at the same byte positions in every record, so it is
+    parsed directly from the text into the array for its field, without
+    splitting the text or creating a Python object for each number.
+    Whitespace surrounding each field is ignored.
+
+    Parameters
+    ----------
+    source
+        The path of a local text file (which is memory-mapped), or a
+        bytes-like object containing the text.
+    colspecs
+        The byte positions of each field within a record, as a list of
+        ``(start, end)`` pairs, where ``end`` is exclusive (like a slice).
+        A field that extends beyond the end of a record is truncated, and
+        so is empty if it starts beyond the end of the record.
+    dtypes : optional
+        The *dtype* of the returned arrays, either one for all fields or
+        a list with one for each field. The default is ``np.float64``.
+    record_length : int, optional
+        The length in bytes of each record (including any line ending),
+        for text in which records are at a fixed stride. The last record
+        may be shorter. The default is *None*, in which case each line is
+        a record, and blank lines are skipped.
+    skip : int, optional
+        The number of records at the start of the text to ignore. The
+        default is 0.
+    masks : bool, optional
+        If *True*, also return a boolean validity mask for each field that
+        is *False* for each record in which the field could not be converted
+        (i.e. for which ``on_fail`` or ``on_overflow`` was used). The default
+        is *False*.
+    inf, nan, on_fail, on_overflow : optional
+        Control how fields are converted - see :func:`try_array`. Each may
+        instead be a list with one value for each field.
+    base, allow_underscores : optional
+        Control how fields are converted. See :func:`try_array`.
+
+    Returns
+    -------
+    list
+        The array of each field, in the order of ``colspecs``.
+    tuple
+        If ``masks`` is *True*, the above *list* and a *list* of the validity
+        mask of each field.
+
+    Raises
+    ------
+    RuntimeError
+        If *numpy* is not installed.
+    OverflowError
+        If a field cannot fit into the desired *dtype* and ``on_overflow`` is
+        set to *RAISE*.
+    ValueError
+        If a field cannot be converted and ``on_fail`` is set to *RAISE*.
+
+    Examples
+    --------
+
+        >>> from fastnumbers import parse_fixed_width
+        >>> import numpy as np
+        >>> ids, prices = parse_fixed_width(
+        ...     b"  17 1.50\\n 204-2.25\\n", [(0, 4), (4, 9)], dtypes=[np.int32, None]
+        ... )
+        >>> ids
+        array([ 17, 204], dtype=int32)
+        >>> prices
+        array([ 1.5 , -2.25])
+
+    """
+    if not has_numpy:
+        raise RuntimeError(
+            "fastnumbers.parse_fixed_width requires numpy to be installed"
+        )
+
+    colspecs = list(colspecs)
+    for spec in colspecs:
+        if len(spec) != 2:
+            raise ValueError(f"Each of 'colspecs' must be (start, end), not {spec!r}")
+    reader = {
+        "starts": [start for start, _ in colspecs],
+        "ends": [end for _, end in colspecs],
+        "record_length": record_length,
+        "skip": skip,
+    }
+    with _text_of(source) as text:
+        rows = _parse_fixed(text, None, **reader)
+        dtypes = _per_column("dtypes", dtypes, len(colspecs))
+        outputs = [np.empty(rows, dtype=d or np.float64) for d in dtypes]
+        validity = [np.ones(rows, dtype=bool) if masks else None for _ in colspecs]
+        _parse_fixed(
+            text,
+            outputs,
+            **reader,
+            masks=validity,
+            inf=_per_column("inf", inf, len(colspecs)),
+            nan=_per_column("nan", nan, len(colspecs)),
+            on_fail=_per_column("on_fail", on_fail, len(colspecs)),
+            on_overflow=_per_column("on_overflow", on_overflow, len(colspecs)),
+            **kwargs,
+        )
+
+    if masks:
+        return outputs, validity
+    return outputs
+
+
+def parse_json_numbers(
+    source,
+    dtype=None,
+    *,
+    null=RAISE,
+    masks=False,
+    on_fail=RAISE,
+    on_overflow=RAISE,
+):
+    """
+    Quickly parse a JSON array of numbers into an array.
+
+    The JSON text is scanned once to check it and find its shape, then each
+    number is parsed directly into the array, without creating a Python
+    object for each one (as :func:`json.loads` would).
+
+    Parameters
+    ----------
+    source
+        The JSON text, as a bytes-like object or a *str*. It must be an array
+        of numbers and nulls, or an array of arrays (all of the same length)
+        of numbers and nulls.
+    dtype : optional
+        The *dtype* of the returned ``ndarray``. The default is ``np.float64``.
+        The *dtype* must be of integral or float type.
+    null : optional
+        Control what happens for a JSON null. The default is *RAISE* to
+        indicate a *TypeError* should be raised (as :func:`try_array` does
+        for *None*), a callable accepting a single argument that will be
+        called with *None* to return an alternate value, or a default value
+        to be returned instead.
+    masks : bool, optional
+        If *True*, also return a boolean validity mask of the same shape that
+        is *False* for each null or number that could not be converted (i.e.
+        for which ``null``, ``on_fail`` or ``on_overflow`` was used). The
+        default is *False*.
+    on_fail : optional
+        Control what happens when a number cannot be converted to the *dtype*
+        (e.g. a number with a fractional part for an integral *dtype*). See
+        :func:`try_array`.
+    on_overflow : optional
+        Control what happens when a number does not fit in the *dtype*.
+        See :func:`try_array`.
+
+    Returns
+    -------
+    ndarray
+        The numbers, with one dimension, or two if the JSON array contains
+        arrays.
+    tuple
+        If ``masks`` is *True*, the above ``ndarray`` and its validity mask.
+
+    Raises
+    ------
+    RuntimeError
+        If *numpy* is not installed.
+    ValueError
+        If the text is not a JSON array of numbers as described above, or if
+        a number cannot be converted and ``on_fail`` is set to *RAISE*.
+    OverflowError
+        If a number cannot fit into the desired *dtype* and ``on_overflow`` is
+        set to *RAISE*.
+    TypeError
+        If there is a null and ``null`` is set to *RAISE*.
+
+    Examples
+    --------
+
+        >>> from fastnumbers import parse_json_numbers
+        >>> import numpy as np
+        >>> parse_json_numbers(b"[1.5, -2e1, null]", null=np.nan)
+        array([  1.5, -20. ,   nan])
+        >>> parse_json_numbers("[[1, 2], [3, null]]", dtype=np.int32, null=-1)
+        array([[ 1,  2],
+               [ 3, -1]], dtype=int32)
+
+    """
+    if not has_numpy:
+        raise RuntimeError(
+            "fastnumbers.parse_json_numbers requires numpy to be installed"
+        )
+
+    if isinstance(source, str):
+        source = source.encode()
+    shape = _parse_json(source, None)
+    result = np.empty(shape, dtype=dtype or np.float64)
+    validity = np.ones(shape, dtype=bool) if masks else None
+    # A two-dimensional array is filled one column at a time
+    if len(shape) == 1:
+        outputs, valid = [result], [validity]
+    else:
+        outputs = [result[:, i] for i in range(shape[1])]
+        valid = [None if validity is None else validity[:, i] for i in range(shape[1])]
+    _parse_json(
+        source,
+        outputs,
+        masks=valid,
+        null=null,
+        on_fail=on_fail,
+        on_overflow=on_overflow,
+    )
+    if masks:
+        return result, validity
+    return result
+
+
+def parse_compressed(
+    source,
+    sep=b"\n",
+    *,
+    dtype=None,
+    skip=0,
+    usecol=None,
+    delimiter=b",",
+    block_size=1 << 20,
+    threads=True,
+    **kwargs,
+):
+    """
+    Quickly parse the numbers in gzip or zlib compressed text into an array.
+
+    The compressed input is decompressed with zlib in blocks of bounded
+    size into reusable native buffers, and each block is parsed as it
+    arrives (see :class:`StreamParser`), so the decompressed text is never
+    held in memory all at once nor copied into Python objects. The
+    compression format is detected from the header of the input.
+
+    Parameters
+    ----------
+    source
+        The path of the compressed file, or a binary file object to read
+        the compressed data from.
+    sep, dtype, skip, usecol, delimiter : optional
+        Control how the text is split into tokens. See :func:`parse_file`.
+    block_size : int, optional
+        The maximum size of the blocks that the input is read and
+        decompressed in. The default is 1 MiB.
+    threads : bool, optional
+        If *True* (the default), the next block is decompressed in a
+        native worker thread while the current block is parsed.
+    inf, nan, on_fail, on_overflow, base, allow_underscores : optional
+        Control how tokens are converted. See :func:`try_array`.
+
+    Returns
+    -------
+    ndarray
+        The parsed numbers, one for each token.
+
+    Raises
+    ------
+    ValueError
+        If the input is neither gzip nor zlib compressed, or is corrupt.
+    EOFError
+        If the compressed input is truncated.
+    RuntimeError
+        If fastnumbers was built without zlib.
+
+    Examples
+    --------
+
+        >>> from fastnumbers import parse_compressed
+        >>> import io, gzip
+        >>> parse_compressed(io.BytesIO(gzip.compress(b"1\\n2\\n3\\n")))
+        array([1., 2., 3.])
+
+    """
+    parser = StreamParser(
+        dtype,
+        sep,
+        skip=skip,
+        usecol=usecol,
+        delimiter=delimiter,
+        collect=True,
+        **kwargs,
+    )
+    fp = open(source, "rb") if not hasattr(source, "read") else source
+    try:
+        # The decompressed text only ever exists in native buffers
+        parser._stream.inflate(
+            fp.read, parser._claim, block_size=block_size, threads=threads
+        )
+        return parser.finish()
+    finally:
+        if fp is not source:
+            fp.close()
+
+
 __all__ = [
     "ALLOWED",
+    "Converter",
     "DISALLOWED",
     "INPUT",
     "NUMBER_ONLY",
     "RAISE",
     "STRING_ONLY",
+    "StreamParser",
     "__version__",
     "check_float",
     "check_int",
@@ -335,12 +1257,22 @@ __all__ = [
     "fast_forceint",
     "fast_int",
     "fast_real",
+    "find_numbers",
     "float",
     "int",
     "isfloat",
     "isint",
     "isintlike",
     "isreal",
+    "natcmp",
+    "natsort_key",
+    "natsort_keys",
+    "natsorted",
+    "parse_columns",
+    "parse_compressed",
+    "parse_file",
+    "parse_fixed_width",
+    "parse_json_numbers",
     "query_type",
     "real",
     "try_array",
@@ -348,4 +1280,5 @@ __all__ = [
     "try_forceint",
     "try_int",
     "try_real",
+    "try_rows",
 ]
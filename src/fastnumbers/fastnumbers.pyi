@@ -4,8 +4,10 @@ from typing import (
     Callable,
     Iterable,
     Iterator,
+    List,
     Literal,
     Sequence,
+    Tuple,
     Type,
     TypeVar,
     overload,
@@ -51,6 +53,8 @@ def try_real(
     coerce: bool = ...,
     allow_underscores: bool = ...,
     map: Literal[False] = ...,
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> pyint: ...
 @overload
 def try_real(
@@ -63,6 +67,8 @@ def try_real(
     coerce: Literal[False],
     allow_underscores: bool = ...,
     map: Literal[False] = ...,
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> pyfloat: ...
 @overload
 def try_real(
@@ -75,6 +81,8 @@ def try_real(
     coerce: bool = ...,
     allow_underscores: bool = ...,
     map: Literal[False] = ...,
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> FloatInt: ...
 @overload
 def try_real(
@@ -93,6 +101,8 @@ def try_real(
     coerce: bool = ...,
     allow_underscores: bool = ...,
     map: Literal[False] = ...,
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> FloatInt | StrInputType: ...
 @overload
 def try_real(
@@ -105,6 +115,8 @@ def try_real(
     coerce: bool = ...,
     allow_underscores: bool = ...,
     map: Literal[False] = ...,
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> FloatInt: ...
 @overload
 def try_real(
@@ -117,6 +129,8 @@ def try_real(
     coerce: bool = ...,
     allow_underscores: bool = ...,
     map: Literal[False] = ...,
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> Any: ...
 @overload
 def try_real(
@@ -129,6 +143,8 @@ def try_real(
     coerce: bool = ...,
     allow_underscores: bool = ...,
     map: Literal[False] = ...,
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> Any: ...
 @overload
 def try_real(
@@ -141,6 +157,8 @@ def try_real(
     coerce: bool = ...,
     allow_underscores: bool = ...,
     map: Literal[False] = ...,
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> FloatInt: ...
 @overload
 def try_real(
@@ -153,6 +171,8 @@ def try_real(
     coerce: bool = ...,
     allow_underscores: bool = ...,
     map: Literal[False] = ...,
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> Any: ...
 @overload
 def try_real(
@@ -165,6 +185,8 @@ def try_real(
     coerce: bool = ...,
     allow_underscores: bool = ...,
     map: Type[list],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> list[pyint]: ...
 @overload
 def try_real(
@@ -177,6 +199,8 @@ def try_real(
     coerce: Literal[False],
     allow_underscores: bool = ...,
     map: Type[list],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> list[pyfloat]: ...
 @overload
 def try_real(
@@ -189,6 +213,8 @@ def try_real(
     coerce: bool = ...,
     allow_underscores: bool = ...,
     map: Type[list],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> list[FloatInt]: ...
 @overload
 def try_real(
@@ -207,6 +233,8 @@ def try_real(
     coerce: bool = ...,
     allow_underscores: bool = ...,
     map: Type[list],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> list[FloatInt | StrInputType]: ...
 @overload
 def try_real(
@@ -219,6 +247,8 @@ def try_real(
     coerce: bool = ...,
     allow_underscores: bool = ...,
     map: Type[list],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> list[FloatInt]: ...
 @overload
 def try_real(
@@ -231,6 +261,8 @@ def try_real(
     coerce: bool = ...,
     allow_underscores: bool = ...,
     map: Type[list],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> list[Any]: ...
 @overload
 def try_real(
@@ -243,6 +275,8 @@ def try_real(
     coerce: bool = ...,
     allow_underscores: bool = ...,
     map: Type[list],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> list[Any]: ...
 @overload
 def try_real(
@@ -255,6 +289,8 @@ def try_real(
     coerce: bool = ...,
     allow_underscores: bool = ...,
     map: Type[list],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> list[FloatInt]: ...
 @overload
 def try_real(
@@ -267,6 +303,8 @@ def try_real(
     coerce: bool = ...,
     allow_underscores: bool = ...,
     map: Type[list],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> list[Any]: ...
 @overload
 def try_real(
@@ -279,6 +317,8 @@ def try_real(
     coerce: bool = ...,
     allow_underscores: bool = ...,
     map: Literal[True],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> Iterator[pyint]: ...
 @overload
 def try_real(
@@ -291,6 +331,8 @@ def try_real(
     coerce: Literal[False],
     allow_underscores: bool = ...,
     map: Literal[True],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> Iterator[pyfloat]: ...
 @overload
 def try_real(
@@ -303,6 +345,8 @@ def try_real(
     coerce: bool = ...,
     allow_underscores: bool = ...,
     map: Literal[True],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> Iterator[FloatInt]: ...
 @overload
 def try_real(
@@ -321,6 +365,8 @@ def try_real(
     coerce: bool = ...,
     allow_underscores: bool = ...,
     map: Literal[True],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> Iterator[FloatInt | StrInputType]: ...
 @overload
 def try_real(
@@ -333,6 +379,8 @@ def try_real(
     coerce: bool = ...,
     allow_underscores: bool = ...,
     map: Literal[True],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> Iterator[FloatInt]: ...
 @overload
 def try_real(
@@ -345,6 +393,8 @@ def try_real(
     coerce: bool = ...,
     allow_underscores: bool = ...,
     map: Literal[True],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> Iterator[Any]: ...
 @overload
 def try_real(
@@ -357,6 +407,8 @@ def try_real(
     coerce: bool = ...,
     allow_underscores: bool = ...,
     map: Literal[True],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> Iterator[Any]: ...
 @overload
 def try_real(
@@ -369,6 +421,8 @@ def try_real(
     coerce: bool = ...,
     allow_underscores: bool = ...,
     map: Literal[True],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> Iterator[FloatInt]: ...
 @overload
 def try_real(
@@ -381,6 +435,8 @@ def try_real(
     coerce: bool = ...,
     allow_underscores: bool = ...,
     map: Literal[True],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> Iterator[Any]: ...
 
 # Try float
@@ -394,6 +450,8 @@ def try_float(
     on_type_error: Any = ...,
     allow_underscores: bool = ...,
     map: Literal[False] = ...,
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> pyfloat: ...
 @overload
 def try_float(
@@ -411,6 +469,8 @@ def try_float(
     on_type_error: Any = ...,
     allow_underscores: bool = ...,
     map: Literal[False] = ...,
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> pyfloat | StrInputType: ...
 @overload
 def try_float(
@@ -422,6 +482,8 @@ def try_float(
     on_type_error: Any = ...,
     allow_underscores: bool = ...,
     map: Literal[False] = ...,
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> pyfloat: ...
 @overload
 def try_float(
@@ -433,6 +495,8 @@ def try_float(
     on_type_error: Any = ...,
     allow_underscores: bool = ...,
     map: Literal[False] = ...,
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> Any: ...
 @overload
 def try_float(
@@ -444,6 +508,8 @@ def try_float(
     on_type_error: Any = ...,
     allow_underscores: bool = ...,
     map: Literal[False] = ...,
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> Any: ...
 @overload
 def try_float(
@@ -455,6 +521,8 @@ def try_float(
     on_type_error: pyfloat | Callable[[AnyInputType], pyfloat],
     allow_underscores: bool = ...,
     map: Literal[False] = ...,
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> pyfloat: ...
 @overload
 def try_float(
@@ -466,6 +534,8 @@ def try_float(
     on_type_error: Any,
     allow_underscores: bool = ...,
     map: Literal[False] = ...,
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> Any: ...
 @overload
 def try_float(
@@ -477,6 +547,8 @@ def try_float(
     on_type_error: Any = ...,
     allow_underscores: bool = ...,
     map: Type[list],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> list[pyfloat]: ...
 @overload
 def try_float(
@@ -494,6 +566,8 @@ def try_float(
     on_type_error: Any = ...,
     allow_underscores: bool = ...,
     map: Type[list],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> list[pyfloat | StrInputType]: ...
 @overload
 def try_float(
@@ -505,6 +579,8 @@ def try_float(
     on_type_error: Any = ...,
     allow_underscores: bool = ...,
     map: Type[list],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> list[pyfloat]: ...
 @overload
 def try_float(
@@ -516,6 +592,8 @@ def try_float(
     on_type_error: Any = ...,
     allow_underscores: bool = ...,
     map: Type[list],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> list[Any]: ...
 @overload
 def try_float(
@@ -527,6 +605,8 @@ def try_float(
     on_type_error: Any = ...,
     allow_underscores: bool = ...,
     map: Type[list],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> list[Any]: ...
 @overload
 def try_float(
@@ -538,6 +618,8 @@ def try_float(
     on_type_error: pyfloat | Callable[[AnyInputType], pyfloat],
     allow_underscores: bool = ...,
     map: Type[list],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> list[pyfloat]: ...
 @overload
 def try_float(
@@ -549,6 +631,8 @@ def try_float(
     on_type_error: Any,
     allow_underscores: bool = ...,
     map: Type[list],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> list[Any]: ...
 @overload
 def try_float(
@@ -560,6 +644,8 @@ def try_float(
     on_type_error: Any = ...,
     allow_underscores: bool = ...,
     map: Literal[True],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> Iterator[pyfloat]: ...
 @overload
 def try_float(
@@ -577,6 +663,8 @@ def try_float(
     on_type_error: Any = ...,
     allow_underscores: bool = ...,
     map: Literal[True],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> Iterator[pyfloat | StrInputType]: ...
 @overload
 def try_float(
@@ -588,6 +676,8 @@ def try_float(
     on_type_error: Any = ...,
     allow_underscores: bool = ...,
     map: Literal[True],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> Iterator[pyfloat]: ...
 @overload
 def try_float(
@@ -599,6 +689,8 @@ def try_float(
     on_type_error: Any = ...,
     allow_underscores: bool = ...,
     map: Literal[True],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> Iterator[Any]: ...
 @overload
 def try_float(
@@ -610,6 +702,8 @@ def try_float(
     on_type_error: Any = ...,
     allow_underscores: bool = ...,
     map: Literal[True],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> Iterator[Any]: ...
 @overload
 def try_float(
@@ -621,6 +715,8 @@ def try_float(
     on_type_error: pyfloat | Callable[[AnyInputType], pyfloat],
     allow_underscores: bool = ...,
     map: Literal[True],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> Iterator[pyfloat]: ...
 @overload
 def try_float(
@@ -632,6 +728,8 @@ def try_float(
     on_type_error: Any,
     allow_underscores: bool = ...,
     map: Literal[True],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> Iterator[Any]: ...
 
 # Try int
@@ -643,6 +741,8 @@ def try_int(
     on_type_error: Any = ...,
     allow_underscores: bool = ...,
     map: Literal[False] = ...,
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> pyint: ...
 @overload
 def try_int(
@@ -653,6 +753,8 @@ def try_int(
     base: IntBaseType = ...,
     allow_underscores: bool = ...,
     map: Literal[False] = ...,
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> pyint | StrInputType: ...
 @overload
 def try_int(
@@ -663,6 +765,8 @@ def try_int(
     base: IntBaseType = ...,
     allow_underscores: bool = ...,
     map: Literal[False] = ...,
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> pyint: ...
 @overload
 def try_int(
@@ -673,6 +777,8 @@ def try_int(
     base: IntBaseType = ...,
     allow_underscores: bool = ...,
     map: Literal[False] = ...,
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> Any: ...
 @overload
 def try_int(
@@ -683,6 +789,8 @@ def try_int(
     base: IntBaseType = ...,
     allow_underscores: bool = ...,
     map: Literal[False] = ...,
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> pyint: ...
 @overload
 def try_int(
@@ -693,6 +801,8 @@ def try_int(
     base: IntBaseType = ...,
     allow_underscores: bool = ...,
     map: Literal[False] = ...,
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> Any: ...
 @overload
 def try_int(
@@ -702,6 +812,8 @@ def try_int(
     on_type_error: Any = ...,
     allow_underscores: bool = ...,
     map: Type[list],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> list[pyint]: ...
 @overload
 def try_int(
@@ -712,6 +824,8 @@ def try_int(
     base: IntBaseType = ...,
     allow_underscores: bool = ...,
     map: Type[list],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> list[pyint | StrInputType]: ...
 @overload
 def try_int(
@@ -722,6 +836,8 @@ def try_int(
     base: IntBaseType = ...,
     allow_underscores: bool = ...,
     map: Type[list],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> list[pyint]: ...
 @overload
 def try_int(
@@ -732,6 +848,8 @@ def try_int(
     base: IntBaseType = ...,
     allow_underscores: bool = ...,
     map: Type[list],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> list[Any]: ...
 @overload
 def try_int(
@@ -742,6 +860,8 @@ def try_int(
     base: IntBaseType = ...,
     allow_underscores: bool = ...,
     map: Type[list],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> list[pyint]: ...
 @overload
 def try_int(
@@ -752,6 +872,8 @@ def try_int(
     base: IntBaseType = ...,
     allow_underscores: bool = ...,
     map: Type[list],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> list[Any]: ...
 @overload
 def try_int(
@@ -761,6 +883,8 @@ def try_int(
     on_type_error: Any = ...,
     allow_underscores: bool = ...,
     map: Literal[True],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> Iterator[pyint]: ...
 @overload
 def try_int(
@@ -771,6 +895,8 @@ def try_int(
     base: IntBaseType = ...,
     allow_underscores: bool = ...,
     map: Literal[True],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> Iterator[pyint | StrInputType]: ...
 @overload
 def try_int(
@@ -781,6 +907,8 @@ def try_int(
     base: IntBaseType = ...,
     allow_underscores: bool = ...,
     map: Literal[True],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> Iterator[pyint]: ...
 @overload
 def try_int(
@@ -791,6 +919,8 @@ def try_int(
     base: IntBaseType = ...,
     allow_underscores: bool = ...,
     map: Literal[True],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> Iterator[Any]: ...
 @overload
 def try_int(
@@ -801,6 +931,8 @@ def try_int(
     base: IntBaseType = ...,
     allow_underscores: bool = ...,
     map: Literal[True],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> Iterator[pyint]: ...
 @overload
 def try_int(
@@ -811,6 +943,8 @@ def try_int(
     base: IntBaseType = ...,
     allow_underscores: bool = ...,
     map: Literal[True],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> Iterator[Any]: ...
 
 # Try forceint
@@ -822,6 +956,8 @@ def try_forceint(
     on_type_error: Any = ...,
     allow_underscores: bool = ...,
     map: Literal[False] = ...,
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> pyint: ...
 @overload
 def try_forceint(
@@ -831,6 +967,8 @@ def try_forceint(
     on_type_error: Any = ...,
     allow_underscores: bool = ...,
     map: Literal[False] = ...,
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> pyint | StrInputType: ...
 @overload
 def try_forceint(
@@ -840,6 +978,8 @@ def try_forceint(
     on_type_error: Any = ...,
     allow_underscores: bool = ...,
     map: Literal[False] = ...,
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> pyint: ...
 @overload
 def try_forceint(
@@ -849,6 +989,8 @@ def try_forceint(
     on_type_error: Any = ...,
     allow_underscores: bool = ...,
     map: Literal[False] = ...,
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> Any: ...
 @overload
 def try_forceint(
@@ -858,6 +1000,8 @@ def try_forceint(
     on_type_error: pyint | Callable[[AnyInputType], pyint],
     allow_underscores: bool = ...,
     map: Literal[False] = ...,
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> pyint: ...
 @overload
 def try_forceint(
@@ -867,6 +1011,8 @@ def try_forceint(
     on_type_error: Any,
     allow_underscores: bool = ...,
     map: Literal[False] = ...,
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> Any: ...
 @overload
 def try_forceint(
@@ -876,6 +1022,8 @@ def try_forceint(
     on_type_error: Any = ...,
     allow_underscores: bool = ...,
     map: Type[list],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> list[pyint]: ...
 @overload
 def try_forceint(
@@ -885,6 +1033,8 @@ def try_forceint(
     on_type_error: Any = ...,
     allow_underscores: bool = ...,
     map: Type[list],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> list[pyint | StrInputType]: ...
 @overload
 def try_forceint(
@@ -894,6 +1044,8 @@ def try_forceint(
     on_type_error: Any = ...,
     allow_underscores: bool = ...,
     map: Type[list],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> list[pyint]: ...
 @overload
 def try_forceint(
@@ -903,6 +1055,8 @@ def try_forceint(
     on_type_error: Any = ...,
     allow_underscores: bool = ...,
     map: Type[list],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> list[Any]: ...
 @overload
 def try_forceint(
@@ -912,6 +1066,8 @@ def try_forceint(
     on_type_error: pyint | Callable[[AnyInputType], pyint],
     allow_underscores: bool = ...,
     map: Type[list],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> list[pyint]: ...
 @overload
 def try_forceint(
@@ -921,6 +1077,8 @@ def try_forceint(
     on_type_error: Any,
     allow_underscores: bool = ...,
     map: Type[list],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> list[Any]: ...
 @overload
 def try_forceint(
@@ -930,6 +1088,8 @@ def try_forceint(
     on_type_error: Any = ...,
     allow_underscores: bool = ...,
     map: Literal[True],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> Iterator[pyint]: ...
 @overload
 def try_forceint(
@@ -939,6 +1099,8 @@ def try_forceint(
     on_type_error: Any = ...,
     allow_underscores: bool = ...,
     map: Literal[True],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> Iterator[pyint | StrInputType]: ...
 @overload
 def try_forceint(
@@ -948,6 +1110,8 @@ def try_forceint(
     on_type_error: Any = ...,
     allow_underscores: bool = ...,
     map: Literal[True],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> Iterator[pyint]: ...
 @overload
 def try_forceint(
@@ -957,6 +1121,8 @@ def try_forceint(
     on_type_error: Any = ...,
     allow_underscores: bool = ...,
     map: Literal[True],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> Iterator[Any]: ...
 @overload
 def try_forceint(
@@ -966,6 +1132,8 @@ def try_forceint(
     on_type_error: pyint | Callable[[AnyInputType], pyint],
     allow_underscores: bool = ...,
     map: Literal[True],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> Iterator[pyint]: ...
 @overload
 def try_forceint(
@@ -975,8 +1143,30 @@ def try_forceint(
     on_type_error: Any,
     allow_underscores: bool = ...,
     map: Literal[True],
+    cache: bool = ...,
+    batch_callables: bool = ...,
 ) -> Iterator[Any]: ...
 
+# Reusable converter
+class Converter:
+    def __init__(
+        self,
+        kind: Literal["real", "float", "int", "forceint"] = ...,
+        *,
+        inf: Any = ...,
+        nan: Any = ...,
+        on_fail: Any = ...,
+        on_overflow: Any = ...,
+        on_type_error: Any = ...,
+        coerce: bool = ...,
+        base: IntBaseType = ...,
+        allow_underscores: bool = ...,
+    ) -> None: ...
+    def __call__(self, x: Any, /) -> Any: ...
+    def map(self, input: Iterable[Any], /) -> Iterator[Any]: ...
+    def list(self, input: Iterable[Any], /) -> list[Any]: ...
+    def array(self, input: Iterable[Any], output: Any) -> None: ...
+
 # Fast real
 @overload
 def fast_real(
@@ -1521,6 +1711,120 @@ def query_type(
     allow_underscores: bool = ...,
 ) -> Type[QueryInputType] | Type[pyint] | Type[pyfloat] | None: ...
 
+# Natural sorting
+NatsortKey = Tuple[pyint | pyfloat | str, ...]
+NatsortInput = TypeVar("NatsortInput", str, pyint, pyfloat)
+
+def natsort_key(
+    x: str | pyint | pyfloat,
+    *,
+    signed: bool = ...,
+    float: bool = ...,
+    exp: bool = ...,
+    casefold: bool = ...,
+) -> NatsortKey: ...
+def natsort_keys(
+    input: Iterable[str | pyint | pyfloat],
+    *,
+    signed: bool = ...,
+    float: bool = ...,
+    exp: bool = ...,
+    casefold: bool = ...,
+) -> List[NatsortKey]: ...
+def natcmp(
+    a: str | pyint | pyfloat,
+    b: str | pyint | pyfloat,
+    *,
+    signed: bool = ...,
+    float: bool = ...,
+    exp: bool = ...,
+    casefold: bool = ...,
+) -> Literal[-1, 0, 1]: ...
+@overload
+def natsorted(
+    input: Iterable[NatsortInput],
+    *,
+    key: None = ...,
+    reverse: bool = ...,
+    signed: bool = ...,
+    float: bool = ...,
+    exp: bool = ...,
+    casefold: bool = ...,
+) -> List[NatsortInput]: ...
+@overload
+def natsorted(
+    input: Iterable[AnyInputType],
+    *,
+    key: Callable[[AnyInputType], str | pyint | pyfloat],
+    reverse: bool = ...,
+    signed: bool = ...,
+    float: bool = ...,
+    exp: bool = ...,
+    casefold: bool = ...,
+) -> List[AnyInputType]: ...
+
+# Finding numbers within text
+@overload
+def find_numbers(
+    text: str,
+    kind: Literal["real"] = ...,
+    *,
+    signed: bool = ...,
+    exp: bool = ...,
+    offsets: Literal[False] = ...,
+    map: Literal[False] = ...,
+) -> List[pyint | pyfloat]: ...
+@overload
+def find_numbers(
+    text: str,
+    kind: Literal["float"],
+    *,
+    signed: bool = ...,
+    exp: bool = ...,
+    offsets: Literal[False] = ...,
+    map: Literal[False] = ...,
+) -> List[pyfloat]: ...
+@overload
+def find_numbers(
+    text: str,
+    kind: Literal["int"],
+    *,
+    signed: bool = ...,
+    exp: bool = ...,
+    offsets: Literal[False] = ...,
+    map: Literal[False] = ...,
+) -> List[pyint]: ...
+@overload
+def find_numbers(
+    text: str,
+    kind: Literal["real", "float", "int"] = ...,
+    *,
+    signed: bool = ...,
+    exp: bool = ...,
+    offsets: Literal[True],
+    map: Literal[False] = ...,
+) -> List[Tuple[pyint | pyfloat, pyint, pyint]]: ...
+@overload
+def find_numbers(
+    text: Iterable[str],
+    kind: Literal["real", "float", "int"] = ...,
+    *,
+    signed: bool = ...,
+    exp: bool = ...,
+    offsets: bool = ...,
+    map: Literal[True],
+) -> Iterator[List[Any]]: ...
+@overload
+def find_numbers(
+    text: Iterable[str],
+    kind: Literal["real", "float", "int"] = ...,
+    *,
+    signed: bool = ...,
+    exp: bool = ...,
+    offsets: bool = ...,
+    map: Type[list],
+) -> List[List[Any]]: ...
+
 # Buitin replacements
 @overload
 def int(x: InputType = ...) -> pyint: ...
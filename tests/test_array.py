@@ -2,6 +2,7 @@ from __future__ import annotations
 
 import array
 import ctypes
+import pickle
 from typing import Any, Callable, Dict, Iterator, List, NoReturn, Tuple, Union
 
 import numpy as np
@@ -19,6 +20,12 @@ from typing_extensions import TypedDict
 import fastnumbers
 from conftest import base_n
 
+# Variable-width strings (StringDType) were added in numpy 2
+requires_string_dtype = pytest.mark.skipif(
+    not hasattr(getattr(np, "dtypes", None), "StringDType"),
+    reason="StringDType requires numpy 2",
+)
+
 
 # Map supported data types to the Python array internal format designator
 formats = {
@@ -460,6 +467,21 @@ class TestErrors:
         with pytest.raises(ValueError, match="Fëanor"):
             fastnumbers.try_array(broken(), output)
 
+    @pytest.mark.parametrize("data_type", data_types)
+    @pytest.mark.parametrize("style", [list, iter])
+    def test_given_raising_callable_fails(
+        self, data_type: str, style: Callable[[Any], Any]
+    ) -> None:
+        """A callable's exception should be returned"""
+
+        def fail(x: str) -> NoReturn:
+            raise ValueError(f"Fëanor {x}")
+
+        given = style(["4", "invalid", "46", "invalid"])
+        output = array.array(formats[data_type], [0, 0, 0, 0])
+        with pytest.raises(ValueError, match="Fëanor invalid"):
+            fastnumbers.try_array(given, output, on_fail=fail)
+
     @pytest.mark.parametrize("data_type", data_types)
     def test_given_non_iterable_raises_type_error(self, data_type: str) -> None:
         output = array.array(formats[data_type], [0, 0, 0, 0])
@@ -503,6 +525,53 @@ class TestSuccess:
         fastnumbers.try_array(given, result)
         assert result == expected
 
+    @pytest.mark.parametrize("data_type", data_types)
+    @pytest.mark.parametrize("distinct", [3, 5000])  # the cache turns off for 5000
+    def test_given_cache_returns_same_results_and_calls_on_fail_each_time(
+        self, data_type: str, distinct: int
+    ) -> None:
+        calls = []
+
+        def on_fail(x: str) -> int:
+            calls.append(x)
+            return 9
+
+        # Build new (non-interned) strings so the cache must compare contents,
+        # padded with whitespace so that they are distinct but in range
+        values = [i % distinct for i in range(5000)]
+        given: List[Any] = [" " * (x // 100) + str(x % 100) for x in values]
+        given += ["invalid", 5, "⑦", "".join(["invalid"])]
+        expected = array.array(formats[data_type], [0] * len(given))
+        result = array.array(formats[data_type], [0] * len(given))
+        fastnumbers.try_array(given, expected, on_fail=on_fail)
+        assert len(calls) == 2
+        fastnumbers.try_array(given, result, on_fail=on_fail, cache=True)
+        assert len(calls) == 4
+        assert result == expected
+
+    @pytest.mark.parametrize("data_type", data_types)
+    @pytest.mark.parametrize("style", [list, iter, np.array])
+    def test_given_batch_calls_each_callable_once(
+        self, data_type: str, style: Callable[[Any], Any]
+    ) -> None:
+        calls = []
+
+        def lengths(xs: List[Any]) -> List[int]:
+            calls.append(list(xs))
+            return [len(x) for x in xs]
+
+        given = style(["4", "invalid", "46", "bad", "1" * 50])
+        result = array.array(formats[data_type], [0, 0, 0, 0, 0])
+        fastnumbers.try_array(
+            given, result, on_fail=lengths, on_overflow=lengths, batch_callables=True
+        )
+        if data_type in int_data_types:
+            assert result == array.array(formats[data_type], [4, 7, 46, 3, 50])
+            assert calls == [["invalid", "bad"], ["1" * 50]]
+        else:
+            assert result[:4] == array.array(formats[data_type], [4, 7, 46, 3])
+            assert calls == [["invalid", "bad"]]
+
     @pytest.mark.parametrize("data_type", int_data_types)
     def test_integer_extremes(self, data_type: str) -> None:
         given = [
@@ -744,6 +813,54 @@ class TestNumpy:
         fastnumbers.try_array(given, result)
         assert np.array_equal(result, expected)
 
+    @pytest.mark.parametrize("dtype", int_dtypes)
+    def test_numpy_scalars_are_floats_for_ints(self, dtype: np.dtype[np.int_]) -> None:
+        # Like any object with __float__, numpy integers are int-like floats
+        given = [np.int64(4), np.uint8(5), np.int8(-1), np.float32(3.0)]
+        expected = np.array([99, 99, 99, 99], dtype=dtype)
+        result = fastnumbers.try_array(given, dtype=dtype, on_overflow=123, on_fail=99)
+        assert np.array_equal(result, expected)
+
+    def test_accepts_numpy_scalars_for_floats(self) -> None:
+        given = [np.int64(4), np.uint8(5), np.int8(-1), np.float32(3.5)]
+        expected = np.array([4.0, 5.0, -1.0, 3.5])
+        assert np.array_equal(fastnumbers.try_array(given), expected)
+
+    @pytest.mark.parametrize("dtype", dtypes)
+    def test_already_converted_data(self, dtype: Any) -> None:
+        given: List[Any] = [1, 2, 3, 300]
+        expected = np.array([1, 2, 3, 123], dtype=dtype)
+        if dtype in float_dtypes or np.iinfo(dtype).max >= 300:
+            expected[3] = 300
+        result = fastnumbers.try_array(given, dtype=dtype, on_overflow=123)
+        assert np.array_equal(result, expected)
+        given = [1.0, 2.5, float("nan"), float("inf")]
+        if dtype in float_dtypes:
+            expected = np.array([1.0, 2.5, 4.0, 5.0], dtype=dtype)
+            result = fastnumbers.try_array(given, dtype=dtype, nan=4.0, inf=5.0)
+        else:
+            expected = np.array([6, 6, 6, 6], dtype=dtype)
+            result = fastnumbers.try_array(given, dtype=dtype, on_fail=6)
+        assert np.array_equal(result, expected)
+
+    def test_already_converted_data_modified_during_conversion(self) -> None:
+        given: List[Any] = [1.0, float("nan"), 3.0]
+
+        def modify(x: float) -> float:
+            given[2] = "7"
+            return 2.0
+
+        result = fastnumbers.try_array(given, nan=modify)
+        assert np.array_equal(result, np.array([1.0, 2.0, 7.0]))
+
+    def test_accepts_object_array_as_input(self) -> None:
+        given = np.array([4, 4.5, "5", "5.6", None, "x"], dtype=object)
+        expected = np.array([4, 4.5, 5, 5.6, -2, -1], dtype=np.float64)
+        result = fastnumbers.try_array(given, on_fail=-1, on_type_error=-2)
+        assert np.array_equal(result, expected)
+        result = fastnumbers.try_array(given[::-2], on_fail=-1, on_type_error=-2)
+        assert np.array_equal(result, expected[::-2])
+
     def test_slice(self) -> None:
         given = [4, "5", "⑦"]
         result = np.array([0, 0, 0, 0, 0])
@@ -807,6 +924,246 @@ class TestNumpy:
         assert np.array_equal(result, expected)
 
 
+class TestNumpyText:
+    """Ensure that fixed-width numpy text arrays are parsed directly"""
+
+    @pytest.mark.parametrize("text_dtype", ["U", "S"])
+    def test_text_arrays_give_correct_results(self, text_dtype: str) -> None:
+        given = np.array(["4", " 4.5 ", "-5", "+5.6e2", "nan", "inf"], dtype=text_dtype)
+        expected = np.array([4, 4.5, -5, 560, np.nan, np.inf], dtype=np.float64)
+        result = fastnumbers.try_array(given)
+        assert np.array_equal(result, expected, equal_nan=True)
+
+    @pytest.mark.parametrize("dtype", int_dtypes)
+    def test_text_arrays_give_correct_results_for_ints(
+        self, dtype: np.dtype[np.int_]
+    ) -> None:
+        given = np.array(["4", "5", "⑦", "1_0", "x"])
+        expected = np.array([4, 5, 7, 10, 99], dtype=dtype)
+        result = fastnumbers.try_array(
+            given, dtype=dtype, allow_underscores=True, on_fail=99
+        )
+        assert np.array_equal(result, expected)
+
+    def test_non_ascii_unicode_digits(self) -> None:
+        given = np.array(["١٢", "٣.٥", "⑦", "\u3000 8 "])
+        expected = np.array([12, 3.5, 7, 8], dtype=np.float64)
+        assert np.array_equal(fastnumbers.try_array(given), expected)
+
+    def test_strided_text_array(self) -> None:
+        given = np.array(["1", "x", "2", "y", "3", "z"])
+        expected = np.array([1, 2, 3], dtype=np.float64)
+        assert np.array_equal(fastnumbers.try_array(given[::2]), expected)
+        expected = np.array([3, 2, 1], dtype=np.float64)
+        assert np.array_equal(fastnumbers.try_array(given[-2::-2]), expected)
+
+    def test_non_native_byte_order(self) -> None:
+        given = np.array(["1", "2.5"], dtype=">U3")
+        expected = np.array([1, 2.5], dtype=np.float64)
+        assert np.array_equal(fastnumbers.try_array(given), expected)
+
+    @requires_string_dtype
+    def test_string_dtype(self) -> None:
+        given = np.array(["1", " 2.5 ", "a much longer string", "٣٤"], dtype="T")
+        expected = np.array([1, 2.5, -1, 34], dtype=np.float64)
+        assert np.array_equal(fastnumbers.try_array(given, on_fail=-1), expected)
+        result = fastnumbers.try_array(given[::-2], on_fail=-1)
+        assert np.array_equal(result, [34, 2.5])
+
+    @requires_string_dtype
+    def test_string_dtype_nulls_are_type_errors(self) -> None:
+        dtype = np.dtypes.StringDType(na_object=None)
+        given = np.array(["1", None, "x"], dtype=dtype)
+        expected = np.array([1, -2, -1], dtype=np.float64)
+        result = fastnumbers.try_array(given, on_fail=-1, on_type_error=-2)
+        assert np.array_equal(result, expected)
+        seen = []
+
+        def on_type_error(x: Any) -> float:
+            seen.append(x)
+            return -2.0
+
+        fastnumbers.try_array(given, on_fail=-1, on_type_error=on_type_error)
+        assert seen == [None]
+        with pytest.raises(TypeError, match="The value None has type 'NoneType'"):
+            fastnumbers.try_array(given, on_fail=-1)
+
+    def test_invalid_text_raises_value_error_with_element(self) -> None:
+        given = np.array(["1", "invalid"])
+        match = "Cannot convert np.str_\\('invalid'\\)"
+        with pytest.raises(ValueError, match=match):
+            fastnumbers.try_array(given)
+
+    @pytest.mark.parametrize("text_dtype", ["U", "S"])
+    def test_callables_are_given_array_elements(self, text_dtype: str) -> None:
+        given = np.array(["1", "invalid", "nan"], dtype=text_dtype)
+        seen = []
+
+        def on_fail(x: Any) -> float:
+            seen.append(x)
+            return 5.0
+
+        expected = np.array([1, 5, 6], dtype=np.float64)
+        result = fastnumbers.try_array(given, on_fail=on_fail, nan=lambda x: 6.0)
+        assert np.array_equal(result, expected)
+        assert seen == [given[1]]
+        assert type(seen[0]) is type(given[1])
+
+    @hyp_given(lists(text(), max_size=50))
+    def test_text_array_matches_list(self, x: List[str]) -> None:
+        # Numpy strips trailing nul characters from its elements
+        x = [y.rstrip("\0") for y in x]
+        given = np.array(x, dtype=str)
+        kwargs: Dict[str, Any] = {"on_fail": 5.0, "inf": 1.0, "nan": 3.0}
+        expected = fastnumbers.try_array(x, **kwargs)
+        result = fastnumbers.try_array(given, **kwargs)
+        assert np.array_equal(result, expected)
+
+
+class TestNumpyNumeric:
+    """Ensure that numeric arrays are converted directly"""
+
+    inputs = [
+        np.array([1.5, -2.0, np.nan, np.inf, -np.inf, 1e300]),
+        np.array([1.0, 2.5], dtype=np.float32),
+        np.array([1, -1, 300, 2**40, -(2**63)]),
+        np.array([0, 5, 255], dtype=np.uint8),
+        np.array([2**64 - 1, 3], dtype=np.uint64),
+        array.array("q", [1, -5, 70000]),
+        array.array("d", [1.0, float("nan")]),
+        np.arange(10)[::-3],
+        np.array([[1, 2], [3, 4]])[:, 1],
+    ]
+
+    @pytest.mark.parametrize("dtype", dtypes)
+    @pytest.mark.parametrize("given", inputs)
+    @pytest.mark.filterwarnings("ignore:overflow encountered in cast")
+    def test_numeric_arrays_match_lists(self, dtype: Any, given: Any) -> None:
+        kwargs: Dict[str, Any] = {
+            "on_fail": lambda x: 1,
+            "on_overflow": lambda x: 2,
+        }
+        if dtype in float_dtypes:
+            kwargs.update(nan=3.0, inf=lambda x: 4.0)
+        expected = fastnumbers.try_array(given.tolist(), dtype=dtype, **kwargs)
+        result = fastnumbers.try_array(given, dtype=dtype, **kwargs)
+        assert np.array_equal(result, expected)
+
+    @pytest.mark.parametrize("dtype", int_dtypes)
+    def test_floats_are_invalid_for_ints(self, dtype: Any) -> None:
+        given = np.array([1.0, 2.0, 3.0])
+        seen = []
+
+        def on_fail(x: Any) -> int:
+            seen.append(x)
+            return 0
+
+        result = fastnumbers.try_array(given, dtype=dtype, on_fail=on_fail)
+        assert np.array_equal(result, np.zeros(3, dtype=dtype))
+        assert seen == list(given)
+        assert type(seen[0]) is np.float64
+        with pytest.raises(ValueError, match="Cannot convert"):
+            fastnumbers.try_array(given, dtype=dtype)
+
+    def test_overflow_raises_overflow_error(self) -> None:
+        given = np.array([1, 2, 300])
+        with pytest.raises(OverflowError, match="Cannot convert"):
+            fastnumbers.try_array(given, dtype=np.uint8)
+        result = fastnumbers.try_array(given, dtype=np.uint8, on_overflow=255)
+        assert np.array_equal(result, np.array([1, 2, 255], dtype=np.uint8))
+
+    def test_output_may_be_strided(self) -> None:
+        given = np.array([1, 2, 3], dtype=np.int16)
+        result = np.zeros(6)
+        fastnumbers.try_array(given, result[::2])
+        assert np.array_equal(result, np.array([1, 0, 2, 0, 3, 0]))
+
+    @pytest.mark.skipif(
+        not hasattr(pickle, "PickleBuffer"), reason="Requires Python 3.8"
+    )
+    @pytest.mark.parametrize("kwargs", [{}, {"on_overflow": 0}])
+    def test_buffers_that_are_not_sequences_are_not_iterable(
+        self, kwargs: Dict[str, Any]
+    ) -> None:
+        given = pickle.PickleBuffer(bytes([1, 200, 3]))
+        with pytest.raises(TypeError, match="not iterable"):
+            fastnumbers.try_array(given, np.empty(3, np.int8), **kwargs)
+
+    def test_output_may_be_a_field_of_a_packed_record_array(self) -> None:
+        result = np.zeros(3, dtype=[("a", np.int8), ("b", np.float64)])
+        fastnumbers.try_array(["1", "2.5", "3"], result["b"])
+        assert result["a"].tolist() == [0, 0, 0]
+        assert result["b"].tolist() == [1.0, 2.5, 3.0]
+
+
+class TestRows:
+    def test_each_field_is_converted_into_its_own_array(self) -> None:
+        rows = [(1, "2.5", b"3"), ("4", 5.0, 6)]
+        ids, prices, counts = fastnumbers.try_rows(
+            rows, [np.int64, np.float32, np.uint8]
+        )
+        assert ids.dtype == np.int64
+        assert ids.tolist() == [1, 4]
+        assert prices.dtype == np.float32
+        assert prices.tolist() == [2.5, 5.0]
+        assert counts.dtype == np.uint8
+        assert counts.tolist() == [3, 6]
+
+    def test_default_is_a_float_array_for_each_field(self) -> None:
+        result = fastnumbers.try_rows(iter([[1, "2"], ["3", 4]]))
+        assert [a.dtype for a in result] == [np.float64, np.float64]
+        assert [a.tolist() for a in result] == [[1.0, 3.0], [2.0, 4.0]]
+        assert fastnumbers.try_rows([]) == []
+
+    def test_structured_dtype_gives_a_record_array(self) -> None:
+        dtype = np.dtype([("id", np.int32), ("price", np.float64), ("n", np.int8)])
+        result = fastnumbers.try_rows([("1", "2.5", 3), (4, 5, "6")], dtype)
+        assert result.dtype == dtype
+        assert result.tolist() == [(1, 2.5, 3), (4, 5.0, 6)]
+
+    def test_replacements_and_masks_are_per_field(self) -> None:
+        rows = [(None, "x", 300), (1, "2", 1)]
+        result, masks = fastnumbers.try_rows(
+            rows,
+            np.uint8,
+            masks=True,
+            on_type_error=[0, 1, 2],
+            on_fail=lambda x: len(x),
+            on_overflow=255,
+        )
+        assert [a.tolist() for a in result] == [[0, 1], [1, 2], [255, 1]]
+        assert [m.tolist() for m in masks] == [
+            [False, True],
+            [False, True],
+            [False, True],
+        ]
+
+    def test_failure_raises_by_default(self) -> None:
+        with pytest.raises(TypeError):
+            fastnumbers.try_rows([(1, None)])
+        with pytest.raises(ValueError, match="Cannot convert 'x'"):
+            fastnumbers.try_rows([(1, "x")])
+
+    @pytest.mark.parametrize(
+        "rows, kwargs",
+        [
+            ([(1, 2), (3,)], {}),
+            ([(1, 2), (3, 4, 5)], {}),
+            ([(1, 2)], {"dtypes": [np.float64]}),
+            ([(1, 2)], {"on_fail": [1, 2, 3]}),
+        ],
+    )
+    def test_rows_must_have_a_value_for_each_field(
+        self, rows: List[Tuple[int, ...]], kwargs: Dict[str, Any]
+    ) -> None:
+        with pytest.raises(ValueError):
+            fastnumbers.try_rows(rows, **kwargs)
+
+    def test_rows_must_be_sequences(self) -> None:
+        with pytest.raises(TypeError, match="each row must be a sequence"):
+            fastnumbers.try_rows([(1,), 2], [np.float64])
+
+
 @hyp_given(
     lists(
         floats() | integers() | text() | binary() | lists(integers(), max_size=1),
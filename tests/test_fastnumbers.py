@@ -1,9 +1,11 @@
 # -*- coding: utf-8 -*-
 # Find the build location and add that to the path
+import gc
 import math
 import random
 import re
 import unicodedata
+import weakref
 from functools import partial
 from itertools import combinations
 from typing import (
@@ -18,6 +20,7 @@ from typing import (
     Union,
 )
 
+import numpy as np
 from hypothesis import example, given
 from hypothesis.strategies import (
     binary,
@@ -670,6 +673,15 @@ class TestUnderscores:
         assert fastnumbers.query_type(x, allow_underscores=True) is int
         assert fastnumbers.query_type(x, allow_underscores=False) is str
 
+    def test_long_numbers_with_underscores_of_varying_length(self) -> None:
+        # Long inputs use storage that is re-used between elements
+        x = ["1_" * n + "1" for n in range(1, 200, 7)]
+        x += x[::-1]
+        expected = [int(y.replace("_", "")) for y in x]
+        assert fastnumbers.try_int(x, map=list, allow_underscores=True) == expected
+        expected = [float(y.replace("_", "")) for y in x]
+        assert fastnumbers.try_float(x, map=list, allow_underscores=True) == expected
+
 
 class TestErrorHandlingConversionFunctionsSuccessful:
     """
@@ -1650,6 +1662,54 @@ class TestQueryType:
         assert fastnumbers.query_type(x, allowed_types=(float, int, str)) is None
 
 
+class TestNumpyScalars:
+    """Ensure numpy scalars behave like the Python numbers they represent"""
+
+    int_types = [np.int8, np.int16, np.int32, np.int64, np.uint8, np.uint64]
+
+    @parametrize("dtype", int_types)
+    @given(integers(min_value=0, max_value=127))
+    def test_integers_behave_like_intlike_float(self, dtype: Any, x: int) -> None:
+        # Like any object with __float__, numpy integers are int-like floats
+        value = dtype(x)
+        assert not fastnumbers.check_int(value)
+        assert fastnumbers.check_float(value)
+        assert fastnumbers.check_intlike(value)
+        assert fastnumbers.query_type(value) is float
+        for func in (fastnumbers.try_int, fastnumbers.try_forceint):
+            result = func(value)
+            assert result == x
+            assert type(result) is int
+        assert type(fastnumbers.try_real(value)) is int
+        result = fastnumbers.try_real(value, coerce=False)
+        assert result == float(x)
+        assert type(result) is float
+        result = fastnumbers.try_float(value)
+        assert result == float(x)
+        assert type(result) is float
+
+    @parametrize("dtype", [np.uint64, np.int64])
+    def test_integer_extremes(self, dtype: Any) -> None:
+        for x in (np.iinfo(dtype).min, np.iinfo(dtype).max):
+            assert fastnumbers.try_int(dtype(x)) == int(x)
+            assert fastnumbers.try_int([dtype(x)], map=list) == [int(x)]
+            assert fastnumbers.try_real(dtype(x), coerce=False) == float(x)
+
+    @given(floats(allow_nan=False, allow_infinity=False, width=32))
+    def test_float32_behaves_like_float(self, x: float) -> None:
+        value = np.float32(x)
+        assert fastnumbers.try_float(value) == x
+        assert fastnumbers.try_real(value, coerce=False) == x
+        assert fastnumbers.check_float(value)
+        assert fastnumbers.query_type(value) is float
+        assert fastnumbers.try_forceint(value) == int(x)
+
+    def test_float32_nan_and_inf(self) -> None:
+        assert fastnumbers.try_float(np.float32("inf"), inf=1.0) == 1.0
+        assert fastnumbers.try_float(np.float32("nan"), nan=2.0) == 2.0
+        assert not fastnumbers.check_float(np.float32("nan"), nan=fastnumbers.DISALLOWED)
+
+
 class TestMappingFunctions:
     """Ensure that mapping functions operate on iterables"""
 
@@ -1672,6 +1732,8 @@ class TestMappingFunctions:
             {"on_fail": fastnumbers.RAISE},
             {"base": 16},
             {"coerce": True},
+            {"coerce": False},
+            {"allow_underscores": True},
         ],
     )
     def test_mapping_non_mapping_behave_the_same(
@@ -1728,6 +1790,9 @@ class TestMappingFunctions:
             lambda: {"6", "4", "590"},
             lambda: iter(["6", "4", "590"]),
             lambda: (x for x in ["6", "4", "590"]),
+            lambda: np.array(["6", "4", "590"], dtype=object),
+            lambda: np.array(["6", "x", "4", "x", "590"], dtype=object)[::2],
+            lambda: np.array(["590", "x", "4", "x", "6"], dtype=object)[::-2],
         ],
     )
     def test_mapping_handles_any_iterable(
@@ -1737,6 +1802,26 @@ class TestMappingFunctions:
         result = sorted(func(iterable_gen()))  # sorted needed b/c of set
         assert result == expected
 
+    @given(lists(floats(allow_nan=False)) | lists(integers()))
+    def test_mapping_already_converted_data(self, x: List[Union[float, int]]) -> None:
+        assert fastnumbers.try_float(x, map=list) == [float(y) for y in x]
+        assert fastnumbers.try_forceint(x, map=list, on_fail=None) == [
+            capture_result(int, y) if math.isfinite(y) else None for y in x
+        ]
+        expected = [int(y) if float(y).is_integer() else y for y in x]
+        assert fastnumbers.try_real(x, map=list) == expected
+        result = fastnumbers.try_real(x, map=list, coerce=False)
+        assert result == x
+        assert [type(y) for y in result] == [type(y) for y in x]
+
+    def test_mapping_already_converted_data_with_replacements(self) -> None:
+        x = [1.5, float("nan"), float("inf"), 2.0]
+        result = fastnumbers.try_float(x, map=list, nan=0.0, inf=1.0)
+        assert result == [1.5, 0.0, 1.0, 2.0]
+        assert fastnumbers.try_real(x, map=list, nan=0, inf=1) == [1.5, 0, 1, 2]
+        result = fastnumbers.try_int([1, 2], map=list, base=16, on_fail=None)
+        assert result == [None, None]
+
     @parametrize(
         "func",
         [
@@ -1802,6 +1887,199 @@ class TestMappingFunctions:
             for _ in func(broken()):
                 pass
 
+    @parametrize("position", [0, 1, 255, 256, 257, 600])
+    @parametrize("style", [list, tuple, iter])
+    def test_mapping_iterator_raises_at_the_failed_element(
+        self, position: int, style: Callable[[Any], Any]
+    ) -> None:
+        """Elements converted ahead of time must not raise early"""
+        calls = []
+
+        def on_fail(x: str) -> str:
+            calls.append(x)
+            if x == "raise":
+                raise ValueError("Fëanor")
+            return x
+
+        given = [str(i) for i in range(700)]
+        given[position] = "raise"
+        given[position + 1] = "fail"
+        result = fastnumbers.try_int(style(given), map=True, on_fail=on_fail)
+        for i in range(position):
+            assert next(result) == i
+        assert calls == []
+        with raises(ValueError, match="Fëanor"):
+            next(result)
+        assert calls == ["raise"]
+        assert next(result) == "fail"
+        assert calls == ["raise", "fail"]
+        assert list(result) == list(range(position + 2, 700))
+        assert calls == ["raise", "fail"]
+
+    def test_mapping_iterator_calls_callables_only_when_requested(self) -> None:
+        calls = []
+
+        def on_fail(x: str) -> int:
+            calls.append(x)
+            return len(calls)
+
+        result = fastnumbers.try_float(["x"] * 1000, map=True, on_fail=on_fail)
+        assert next(result) == 1
+        assert len(calls) == 1
+        assert next(result) == 2
+        assert len(calls) == 2
+
+    def test_mapping_iterator_runs_python_code_only_when_requested(self) -> None:
+        calls = []
+
+        class Number:
+            def __float__(self) -> float:
+                calls.append(self)
+                return 5.0
+
+        result = fastnumbers.try_float(["1", "2", Number(), "3"], map=True)
+        assert next(result) == 1.0
+        assert next(result) == 2.0
+        assert calls == []
+        assert next(result) == 5.0
+        assert calls
+        assert list(result) == [3.0]
+
+    @parametrize("hint", [0, 1, 3, 5, 1000])
+    def test_mapping_to_list_ignores_wrong_length_hint(self, hint: int) -> None:
+        class Hinted:
+            def __init__(self) -> None:
+                self.values = iter(["4", "6", "590", "7", "8"])
+
+            def __iter__(self) -> "Hinted":
+                return self
+
+            def __next__(self) -> str:
+                return next(self.values)
+
+            def __length_hint__(self) -> int:
+                return hint
+
+        expected = [4, 6, 590, 7, 8]
+        assert fastnumbers.try_int(Hinted(), map=list) == expected
+
+    @parametrize(
+        "func",
+        [
+            partial(fastnumbers.try_real, on_fail=len, inf=0.5),
+            partial(fastnumbers.try_float, on_fail=len, nan="nan!"),
+            partial(fastnumbers.try_int, on_fail=len),
+            partial(fastnumbers.try_forceint, on_fail=len),
+        ],
+    )
+    @parametrize("map_type", [True, list])
+    @parametrize("distinct", [3, 10_000])  # the cache turns itself off for 10_000
+    def test_mapping_with_cache_matches_without_cache(
+        self, func: ConversionFuncs, map_type: Any, distinct: int
+    ) -> None:
+        # Build new (non-interned) strings so the cache must compare contents
+        words = ["1", "2.5", "-7e2", "inf", "nan", "fëanor", "0x1", "4_2", "⑦"]
+        given = [
+            "".join([words[i % len(words)], str(i % distinct)]) for i in range(10_000)
+        ] + [5, 6.5, b"12"] * 3
+        expected = list(func(given, map=map_type))
+        result = list(func(given, map=map_type, cache=True))
+        assert result == expected or str(result) == str(expected)  # NaN != NaN
+
+    def test_mapping_to_list_with_cache_shares_results_and_still_calls_on_fail(
+        self,
+    ) -> None:
+        calls = []
+
+        def on_fail(x: str) -> str:
+            calls.append(x)
+            return x
+
+        given = ["".join(["12", "3.5"]) for _ in range(5)] + ["bad"] * 5
+        result = fastnumbers.try_float(given, map=list, cache=True, on_fail=on_fail)
+        assert result == [123.5] * 5 + ["bad"] * 5
+        assert all(x is result[0] for x in result[:5])
+        assert calls == ["bad"] * 5
+
+    @parametrize(
+        "func",
+        [
+            fastnumbers.try_real,
+            fastnumbers.try_float,
+            fastnumbers.try_int,
+            fastnumbers.try_forceint,
+        ],
+    )
+    def test_mapping_to_list_with_batch_calls_each_callable_once(
+        self, func: ConversionFuncs
+    ) -> None:
+        calls = []
+
+        def batch(xs: List[Any]) -> List[str]:
+            calls.append(xs)
+            return [repr(x) for x in xs]
+
+        given = ["4", "bad", None, "7", "worse", 3j, "9"]
+        expected = func(given, map=list, on_fail=repr, on_type_error=repr)
+        result = func(
+            given, map=list, on_fail=batch, on_type_error=batch, batch_callables=True
+        )
+        assert result == expected
+        assert calls == [["bad", "worse"], [None, 3j]]
+
+    def test_mapping_to_list_with_batch_calls_inf_and_nan_once(self) -> None:
+        def upper(xs: List[str]) -> List[str]:
+            return [x.upper() for x in xs]
+
+        given = ["inf", "1", "-inf", "nan", "fail"]
+        expected = ["INF", 1.0, "-INF", "NAN", "fail"]
+        result = fastnumbers.try_float(
+            given, map=list, inf=upper, nan=upper, batch_callables=True
+        )
+        assert result == expected
+
+    def test_mapping_with_batch_checks_number_of_returned_values(self) -> None:
+        given = ["bad", "4", "worse"]
+        with raises(ValueError, match="'on_fail' returned 1 values for 2 inputs"):
+            fastnumbers.try_float(
+                given, map=list, on_fail=lambda xs: [1], batch_callables=True
+            )
+        with raises(ZeroDivisionError):
+            fastnumbers.try_float(
+                given, map=list, on_fail=lambda xs: 1 / 0, batch_callables=True
+            )
+
+    def test_mapping_to_iterator_ignores_batch(self) -> None:
+        given = ["bad", "4", "worse"]
+        result = fastnumbers.try_float(
+            given, map=True, on_fail=len, batch_callables=True
+        )
+        assert list(result) == [3, 4.0, 5]
+
+    @parametrize(
+        "func",
+        [
+            partial(fastnumbers.try_real, map=list),
+            partial(fastnumbers.try_float, map=list),
+            partial(fastnumbers.try_int, map=list),
+            partial(fastnumbers.try_forceint, map=list),
+            partial(fastnumbers.try_real, map=True),
+            partial(fastnumbers.try_float, map=True),
+            partial(fastnumbers.try_int, map=True),
+            partial(fastnumbers.try_forceint, map=True),
+        ],
+    )
+    def test_mapping_handles_raising_callable(self, func: ConversionFuncs) -> None:
+        """An exception from an on_fail callable should be returned"""
+
+        def fail(x: str) -> NoReturn:
+            raise ValueError(f"Fëanor {x}")
+
+        x = ["5", "6", "invalid", "7", "invalid"]
+        with raises(ValueError, match="Fëanor invalid"):
+            for _ in func(x, on_fail=fail):
+                pass
+
     @parametrize(
         "func",
         [
@@ -1895,3 +2173,112 @@ class TestMappingFunctions:
         expected = [5]
         result = list(func(style([("Fëanor",)]), on_type_error=5))
         assert result == expected
+
+
+class TestConverter:
+    """Ensure that the reusable converter behaves like the try_* functions"""
+
+    @given(lists(floats() | integers() | text(max_size=50), max_size=50))
+    @parametrize(
+        "kind, func",
+        [
+            ("real", fastnumbers.try_real),
+            ("float", fastnumbers.try_float),
+            ("int", fastnumbers.try_int),
+            ("forceint", fastnumbers.try_forceint),
+        ],
+    )
+    @parametrize(
+        "kwargs",
+        [
+            {},
+            {"on_fail": fastnumbers.RAISE},
+            {"on_fail": len, "on_type_error": None},
+            {"inf": 7.0, "nan": fastnumbers.RAISE, "coerce": False},
+            {"base": 16},
+            {"allow_underscores": True},
+        ],
+    )
+    def test_converter_behaves_like_try_function(
+        self,
+        kind: str,
+        func: ConversionFuncs,
+        kwargs: Dict[str, Any],
+        x: List[Union[float, int, str]],
+    ) -> None:
+        # Only give the try_* function the options it accepts
+        accepted = {"on_fail", "on_type_error", "allow_underscores"}
+        if kind in ("real", "float"):
+            accepted |= {"inf", "nan"}
+        if kind == "real":
+            accepted.add("coerce")
+        if kind == "int":
+            accepted.add("base")
+        func = partial(func, **{k: v for k, v in kwargs.items() if k in accepted})
+
+        converter = fastnumbers.Converter(kind, **kwargs)
+        expected = capture_result(func, x, map=list)
+        assert capture_result(converter.list, x) == expected
+        assert capture_result(lambda y: list(converter.map(y)), x) == expected
+        assert capture_result(lambda y: [converter(z) for z in y], x) == expected
+
+    def test_converter_default_is_real(self) -> None:
+        assert fastnumbers.Converter()("4.0") == 4
+        assert repr(fastnumbers.Converter()) == "fastnumbers.Converter(kind='real')"
+        assert repr(fastnumbers.Converter("int")) == "fastnumbers.Converter(kind='int')"
+
+    def test_converter_map_outlives_converter(self) -> None:
+        result = fastnumbers.Converter("float", on_fail=0.0).map(["5", "x"])
+        assert list(result) == [5.0, 0.0]
+
+    def test_converter_referred_to_by_its_callable_is_collected(self) -> None:
+        class Handler:
+            def __init__(self) -> None:
+                self.converter = fastnumbers.Converter("float", on_fail=self.fallback)
+
+            def fallback(self, x: str) -> float:
+                return -1.0
+
+        handler = Handler()
+        assert handler.converter("x") == -1.0
+        ref = weakref.ref(handler)
+        del handler
+        gc.collect()
+        assert ref() is None
+
+    @parametrize(
+        "args, kwargs",
+        [((), {}), (("5", "6"), {}), (("5",), {"on_fail": 0})],
+    )
+    def test_converter_only_accepts_a_single_positional(
+        self, args: Tuple[Any, ...], kwargs: Dict[str, Any]
+    ) -> None:
+        converter = fastnumbers.Converter()
+        with raises(TypeError, match="exactly one positional argument"):
+            converter(*args, **kwargs)
+
+    def test_converter_validates_options_on_creation(self) -> None:
+        with raises(ValueError, match="kind must be one of"):
+            fastnumbers.Converter("complex")
+        with raises(TypeError):
+            fastnumbers.Converter(5)  # type: ignore
+        with raises(ValueError, match="'on_fail' and 'on_type_error' cannot be"):
+            fastnumbers.Converter(on_fail=fastnumbers.ALLOWED)
+        with raises(ValueError, match="'inf' and 'nan' cannot be"):
+            fastnumbers.Converter(inf=fastnumbers.DISALLOWED)
+        with raises(ValueError, match="base must be"):
+            fastnumbers.Converter("int", base=40)
+
+    @parametrize("dtype", [np.float64, np.int32, np.uint8])
+    def test_converter_array_behaves_like_try_array(self, dtype: Any) -> None:
+        x = ["5", "invalid", "7", 8, "0x10"]
+        converter = fastnumbers.Converter(on_fail=3, base=0)
+        expected = fastnumbers.try_array(x, dtype=dtype, on_fail=3, base=0)
+        result = np.empty(len(x), dtype=dtype)
+        assert converter.array(x, result) is None
+        assert np.array_equal(result, expected)
+
+    def test_converter_array_raises_when_on_fail_is_input(self) -> None:
+        result = np.empty(2, dtype=np.float64)
+        with raises(ValueError, match="Cannot convert 'invalid'"):
+            fastnumbers.Converter().array(["5", "invalid"], result)
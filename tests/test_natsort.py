@@ -0,0 +1,207 @@
+from __future__ import annotations
+
+import re
+from typing import Any, Dict, List
+
+import pytest
+from hypothesis import given
+from hypothesis.strategies import integers, lists, text
+
+import fastnumbers
+
+
+def regex_key(x: str) -> tuple[Any, ...]:
+    """The key natsort_key makes by default, made with a regular expression."""
+    chunks: List[Any] = re.split(r"(\d+)", x, flags=re.ASCII)
+    chunks[1::2] = map(int, chunks[1::2])
+    if chunks[-1] == "":
+        chunks.pop()
+    return tuple(chunks)
+
+
+class TestNatsortKey:
+    @pytest.mark.parametrize(
+        "x, expected",
+        [
+            ("", ()),
+            ("abc", ("abc",)),
+            ("a10b", ("a", 10, "b")),
+            ("12 apples", ("", 12, " apples")),
+            ("version-1.10.2", ("version-", 1, ".", 10, ".", 2)),
+            ("007", ("", 7)),
+        ],
+    )
+    def test_splits_text_and_numbers(self, x: str, expected: tuple[Any, ...]) -> None:
+        assert fastnumbers.natsort_key(x) == expected
+
+    @given(text(alphabet="ab01. "))
+    def test_matches_regex_split(self, x: str) -> None:
+        assert fastnumbers.natsort_key(x) == regex_key(x)
+
+    def test_numbers_of_other_scripts_are_numbers(self) -> None:
+        assert fastnumbers.natsort_key("a٣٤b") == ("a", 34, "b")
+
+    def test_large_numbers_do_not_overflow(self) -> None:
+        assert fastnumbers.natsort_key("x" + "9" * 30) == ("x", int("9" * 30))
+
+    def test_signed(self) -> None:
+        assert fastnumbers.natsort_key("a-5") == ("a-", 5)
+        assert fastnumbers.natsort_key("a-5", signed=True) == ("a", -5)
+        assert fastnumbers.natsort_key("a+5", signed=True) == ("a", 5)
+
+    def test_float(self) -> None:
+        assert fastnumbers.natsort_key("x1.5e3y", float=True) == ("x", 1500.0, "y")
+        assert fastnumbers.natsort_key("x1.5e3", float=True, exp=False) == (
+            "x",
+            1.5,
+            "e",
+            3.0,
+        )
+        assert fastnumbers.natsort_key("1e", float=True) == ("", 1.0, "e")
+        assert fastnumbers.natsort_key(".5", float=True) == ("", 0.5)
+        assert fastnumbers.natsort_key(".", float=True) == (".",)
+
+    def test_adjacent_numbers_are_separated_by_empty_text(self) -> None:
+        assert fastnumbers.natsort_key("1.2.3", float=True) == ("", 1.2, "", 0.3)
+        assert fastnumbers.natsort_key("1-2", signed=True) == ("", 1, "", -2)
+
+    def test_casefold(self) -> None:
+        assert fastnumbers.natsort_key("ABC1", casefold=True) == ("abc", 1)
+        assert fastnumbers.natsort_key("Straße1", casefold=True) == ("strasse", 1)
+
+    @pytest.mark.parametrize("x", [5, 5.5, -3])
+    def test_numbers_sort_as_text_containing_only_the_number(self, x: Any) -> None:
+        assert fastnumbers.natsort_key(x) == ("", x)
+
+    @pytest.mark.parametrize("x", [None, b"a1", ["a1"]])
+    def test_other_types_are_a_type_error(self, x: Any) -> None:
+        with pytest.raises(TypeError, match="natural sort keys"):
+            fastnumbers.natsort_key(x)
+
+    def test_sorts_naturally(self) -> None:
+        given = ["a10", "a2", "b", "a1", "", "10", "9", "a2b"]
+        expected = ["", "9", "10", "a1", "a2", "a2b", "a10", "b"]
+        assert sorted(given, key=fastnumbers.natsort_key) == expected
+
+    def test_mixed_numbers_and_text_sort_together(self) -> None:
+        given = ["x", 10, "2", 1.5]
+        expected = [1.5, "2", 10, "x"]
+        key = lambda x: fastnumbers.natsort_key(x, float=True)  # noqa: E731
+        assert sorted(given, key=key) == expected
+
+
+class TestNatsortKeys:
+    @given(lists(text(alphabet="aB01.-")))
+    def test_matches_natsort_key(self, x: List[str]) -> None:
+        options = {"signed": True, "float": True, "casefold": True}
+        expected = [fastnumbers.natsort_key(y, **options) for y in x]
+        assert fastnumbers.natsort_keys(x, **options) == expected
+
+    @given(lists(integers()))
+    def test_accepts_iterables(self, x: List[int]) -> None:
+        assert fastnumbers.natsort_keys(iter(x)) == [("", y) for y in x]
+
+    def test_other_types_are_a_type_error(self) -> None:
+        with pytest.raises(TypeError, match="not NoneType"):
+            fastnumbers.natsort_keys(["a", None])
+
+
+def key_compare(a: Any, b: Any, **options: bool) -> int:
+    key_a = fastnumbers.natsort_key(a, **options)
+    key_b = fastnumbers.natsort_key(b, **options)
+    return (key_a > key_b) - (key_a < key_b)
+
+
+OPTIONS = [
+    {},
+    {"signed": True},
+    {"float": True},
+    {"float": True, "signed": True},
+    {"float": True, "exp": False},
+    {"casefold": True},
+]
+
+
+class TestNatcmp:
+    @pytest.mark.parametrize("options", OPTIONS)
+    @given(text(alphabet="aB0129.-+eE٣"), text(alphabet="aB0129.-+eE٣"))
+    def test_matches_comparing_keys(
+        self, options: Dict[str, bool], a: str, b: str
+    ) -> None:
+        assert fastnumbers.natcmp(a, b, **options) == key_compare(a, b, **options)
+
+    @pytest.mark.parametrize("options", OPTIONS)
+    @given(text(alphabet="a01.-e"), text(alphabet="a01.-e"), text(alphabet="a01.-e"))
+    def test_matches_comparing_keys_with_common_prefix(
+        self, options: Dict[str, bool], prefix: str, a: str, b: str
+    ) -> None:
+        a, b = prefix + a, prefix + b
+        assert fastnumbers.natcmp(a, b, **options) == key_compare(a, b, **options)
+
+    @pytest.mark.parametrize(
+        "a, b, expected",
+        [
+            ("a2", "a10", -1),
+            ("a10", "a2", 1),
+            ("a010", "a10", 0),
+            ("a", "a1", -1),
+            ("a1", "a1b", -1),
+            ("a1b", "ab", -1),
+            ("", "1", -1),
+            ("x" + "9" * 30, "x1" + "0" * 30, -1),
+        ],
+    )
+    def test_compares_numbers_by_value(self, a: str, b: str, expected: int) -> None:
+        assert fastnumbers.natcmp(a, b) == expected
+
+    def test_signed(self) -> None:
+        assert fastnumbers.natcmp("x-1", "x-2", signed=True) == 1
+        assert fastnumbers.natcmp("x-0", "x+0", signed=True) == 0
+
+    def test_numbers_are_compared_by_key(self) -> None:
+        assert fastnumbers.natcmp(3, "3") == 0
+        assert fastnumbers.natcmp(2.5, "a") == -1
+
+    def test_other_types_are_a_type_error(self) -> None:
+        with pytest.raises(TypeError, match="not NoneType"):
+            fastnumbers.natcmp("a", None)
+
+
+class TestNatsorted:
+    @pytest.mark.parametrize("options", OPTIONS)
+    @given(lists(text(alphabet="aB019.-e")))
+    def test_matches_sorting_by_key(
+        self, options: Dict[str, bool], x: List[str]
+    ) -> None:
+        def key(y: str) -> tuple[Any, ...]:
+            return fastnumbers.natsort_key(y, **options)
+
+        assert fastnumbers.natsorted(x, **options) == sorted(x, key=key)
+        expected = sorted(x, key=key, reverse=True)
+        assert fastnumbers.natsorted(x, reverse=True, **options) == expected
+
+    def test_is_stable(self) -> None:
+        given = ["a01", "a1", "b", "a001"]
+        assert fastnumbers.natsorted(given) == ["a01", "a1", "a001", "b"]
+        assert fastnumbers.natsorted(given, reverse=True) == ["b", "a01", "a1", "a001"]
+
+    def test_key(self) -> None:
+        given = [("x", "v1.10"), ("y", "v1.9")]
+        expected = [("y", "v1.9"), ("x", "v1.10")]
+        assert fastnumbers.natsorted(given, key=lambda p: p[1]) == expected
+
+    def test_mixed_numbers_and_text_sort_together(self) -> None:
+        given = ["x", 10, "2", 1.5]
+        assert fastnumbers.natsorted(given, float=True) == [1.5, "2", 10, "x"]
+
+    def test_accepts_iterables(self) -> None:
+        assert fastnumbers.natsorted(iter(["a10", "a9"])) == ["a9", "a10"]
+        assert fastnumbers.natsorted([]) == []
+
+    def test_errors(self) -> None:
+        with pytest.raises(TypeError, match="not NoneType"):
+            fastnumbers.natsorted(["a", None])
+        with pytest.raises(TypeError, match="'key' must be callable"):
+            fastnumbers.natsorted(["a"], key=3)  # type: ignore[call-overload]
+        with pytest.raises(ZeroDivisionError):
+            fastnumbers.natsorted(["a"], key=lambda x: 1 / 0)
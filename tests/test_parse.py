@@ -0,0 +1,546 @@
+from __future__ import annotations
+
+import gc
+import gzip
+import io
+import json
+import pathlib
+import tempfile
+import weakref
+import zlib
+from typing import List, Tuple
+
+import numpy as np
+import pytest
+from hypothesis import given
+from hypothesis.strategies import floats, integers, lists
+
+import fastnumbers
+
+
+def write(tmp_path: pathlib.Path, data: bytes) -> pathlib.Path:
+    path = tmp_path / "data.txt"
+    path.write_bytes(data)
+    return path
+
+
+class TestParseFile:
+    @given(lists(floats(allow_nan=False)))
+    def test_one_number_per_line_matches_float(self, x: List[float]) -> None:
+        # Hypothesis does not allow function-scoped fixtures like tmp_path
+        with tempfile.TemporaryDirectory() as directory:
+            path = write(pathlib.Path(directory), "\n".join(map(repr, x)).encode())
+            result = fastnumbers.parse_file(path)
+        assert result.dtype == np.float64
+        assert result.tolist() == x
+
+    def test_empty_file_gives_empty_array(self, tmp_path: pathlib.Path) -> None:
+        result = fastnumbers.parse_file(write(tmp_path, b""), dtype=np.int32)
+        assert result.dtype == np.int32
+        assert len(result) == 0
+
+    @pytest.mark.parametrize(
+        "data", [b"1\n2\n3", b"1\n2\n3\n", b"1\r\n2\r\n3\r\n", b" 1 \n\t2\n3  \n"]
+    )
+    def test_line_endings_and_whitespace_are_ignored(
+        self, tmp_path: pathlib.Path, data: bytes
+    ) -> None:
+        result = fastnumbers.parse_file(write(tmp_path, data), dtype=np.int64)
+        assert result.tolist() == [1, 2, 3]
+
+    @pytest.mark.parametrize("sep", [b",", ",", b"::"])
+    def test_given_sep_splits_on_it(self, tmp_path: pathlib.Path, sep: bytes) -> None:
+        data = (sep if isinstance(sep, bytes) else sep.encode()).join([b"4", b"5.5"])
+        result = fastnumbers.parse_file(write(tmp_path, data), sep)
+        assert result.tolist() == [4.0, 5.5]
+
+    def test_skip_and_usecol_select_a_column(self, tmp_path: pathlib.Path) -> None:
+        data = b"a;b;c\n1;2;3\n4;5;6\n7;8\n"
+        path = write(tmp_path, data)
+        result = fastnumbers.parse_file(path, skip=1, usecol=1, delimiter=";")
+        assert result.tolist() == [2.0, 5.0, 8.0]
+        result = fastnumbers.parse_file(
+            path, skip=1, usecol=2, delimiter=b";", on_fail=0
+        )
+        assert result.tolist() == [3.0, 6.0, 0.0]
+        result = fastnumbers.parse_file(path, skip=10)
+        assert result.tolist() == []
+
+    def test_empty_records_are_tokens(self, tmp_path: pathlib.Path) -> None:
+        path = write(tmp_path, b"1\n\n2\n")
+        result = fastnumbers.parse_file(path, on_fail=-1)
+        assert result.tolist() == [1.0, -1.0, 2.0]
+
+    def test_failure_is_handled_like_try_array(self, tmp_path: pathlib.Path) -> None:
+        path = write(tmp_path, b"1\nnan\ninf\nabc\n")
+        result = fastnumbers.parse_file(
+            path, dtype=np.float32, nan=0.0, inf=len, on_fail=lambda x: len(x) * 10
+        )
+        assert result.tolist() == [1.0, 0.0, 3.0, 30.0]
+        with pytest.raises(ValueError, match="Cannot convert 'abc' to C type 'double'"):
+            fastnumbers.parse_file(path)
+        with pytest.raises(TypeError, match="returned the value 'ABC'"):
+            fastnumbers.parse_file(path, on_fail=str.upper)
+
+    def test_overflow_is_handled_like_try_array(self, tmp_path: pathlib.Path) -> None:
+        path = write(tmp_path, b"1\n300\n-1\n")
+        result = fastnumbers.parse_file(path, dtype=np.uint8, on_overflow=255)
+        assert result.tolist() == [1, 255, 255]
+        with pytest.raises(OverflowError):
+            fastnumbers.parse_file(path, dtype=np.uint8)
+
+    def test_base_is_used_for_integers(self, tmp_path: pathlib.Path) -> None:
+        path = write(tmp_path, b"ff\n0x10\n1_0\n")
+        result = fastnumbers.parse_file(path, dtype=np.int32, base=16, on_fail=-1)
+        assert result.tolist() == [255, 16, -1]
+        result = fastnumbers.parse_file(
+            path, dtype=np.int32, base=16, allow_underscores=True
+        )
+        assert result.tolist() == [255, 16, 16]
+
+    @pytest.mark.parametrize(
+        "kwargs, exception",
+        [
+            ({"sep": b""}, ValueError),
+            ({"sep": 5}, TypeError),
+            ({"skip": -1}, ValueError),
+            ({"usecol": -1}, ValueError),
+            ({"on_fail": fastnumbers.ALLOWED}, ValueError),
+        ],
+    )
+    def test_invalid_options_raise(
+        self, tmp_path: pathlib.Path, kwargs: dict, exception: type
+    ) -> None:
+        with pytest.raises(exception):
+            fastnumbers.parse_file(write(tmp_path, b"1\n"), **kwargs)
+
+
+class TestStreamParser:
+    @given(lists(floats(allow_nan=False)), lists(integers(1, 20), min_size=1))
+    def test_any_chunking_matches_parsing_all_at_once(
+        self, x: List[float], sizes: List[int]
+    ) -> None:
+        data = b"\r\n".join(repr(value).encode() for value in x)
+        parser = fastnumbers.StreamParser(sep=b"\r\n")
+        results = []
+        start = 0
+        while start < len(data):
+            size = sizes[len(results) % len(sizes)]
+            results.append(parser.feed(data[start : start + size]))
+            start += size
+        results.append(parser.finish())
+        assert np.concatenate(results).tolist() == x
+
+    def test_one_byte_chunks_match_parsing_all_at_once(self) -> None:
+        data = b"x<>y<>" + b"<>".join(str(i).encode() for i in range(1000))
+        parser = fastnumbers.StreamParser(np.int64, b"<>", skip=2, collect=True)
+        for i in range(len(data)):
+            assert parser.feed(data[i : i + 1]) is None
+        assert parser.finish().tolist() == list(range(1000))
+
+    def test_cannot_be_used_while_parsing(self) -> None:
+        def on_fail(x: str) -> object:
+            return parser.feed(b"1\n")
+
+        parser = fastnumbers.StreamParser(on_fail=on_fail)
+        with pytest.raises(RuntimeError, match="while it is parsing"):
+            parser.feed(b"a\n")
+        assert parser.feed(b"2\n").tolist() == [2.0]
+
+    def test_collect_appends_to_one_array(self) -> None:
+        parser = fastnumbers.StreamParser(np.int16, skip=2, collect=True)
+        chunks = [b"header\n", b"units", b"\n1\n2", b"\n", bytearray(b"3\n4")]
+        for chunk in chunks:
+            assert parser.feed(chunk) is None
+        result = parser.finish()
+        assert result.dtype == np.int16
+        assert result.tolist() == [1, 2, 3, 4]
+
+    def test_finish_resets_the_parser(self) -> None:
+        parser = fastnumbers.StreamParser(np.int64, b",", skip=1, collect=True)
+        parser.feed(b"0,1,2")
+        assert parser.finish().tolist() == [1, 2]
+        parser.feed(b"0,3")
+        assert parser.finish().tolist() == [3]
+
+    def test_chunk_is_not_consumed_if_an_error_is_raised(self) -> None:
+        parser = fastnumbers.StreamParser(np.uint8, usecol=1)
+        assert parser.feed(b"a,1\nb,").tolist() == [1]
+        with pytest.raises(OverflowError):
+            parser.feed(b"2\nc,300\n")
+        assert parser.feed(b"2\nc,3\n").tolist() == [2, 3]
+        assert parser.finish().tolist() == []
+
+    def test_replacements_are_used(self) -> None:
+        parser = fastnumbers.StreamParser(on_fail=len, nan=-1.0)
+        assert parser.feed(b"nan\nabc\n").tolist() == [-1.0, 3.0]
+
+    def test_parser_referred_to_by_its_callable_is_collected(self) -> None:
+        class Handler:
+            def __init__(self) -> None:
+                self.parser = fastnumbers.StreamParser(on_fail=self.handle)
+
+            def handle(self, x: str) -> float:
+                return -1.0
+
+        handler = Handler()
+        assert handler.parser.feed(b"x\n").tolist() == [-1.0]
+        ref = weakref.ref(handler)
+        del handler
+        gc.collect()
+        assert ref() is None
+
+    def test_invalid_options_raise_on_construction(self) -> None:
+        with pytest.raises(ValueError):
+            fastnumbers.StreamParser(sep=b"")
+        with pytest.raises(ValueError):
+            fastnumbers.StreamParser(on_fail=fastnumbers.ALLOWED)
+
+
+class TestParseCompressed:
+    data = b"".join(b"%d\n" % i for i in range(1000))
+    expected = [float(i) for i in range(1000)]
+
+    @pytest.mark.parametrize("threads", [True, False])
+    @pytest.mark.parametrize("block_size", [1, 7, 1 << 20])
+    def test_gzip_file_is_parsed(
+        self, tmp_path: pathlib.Path, threads: bool, block_size: int
+    ) -> None:
+        path = write(tmp_path, gzip.compress(self.data))
+        result = fastnumbers.parse_compressed(
+            path, block_size=block_size, threads=threads
+        )
+        assert result.tolist() == self.expected
+
+    def test_zlib_file_object_is_parsed(self) -> None:
+        source = io.BytesIO(zlib.compress(self.data))
+        result = fastnumbers.parse_compressed(source, dtype=np.int32, block_size=64)
+        assert result.tolist() == list(range(1000))
+        assert not source.closed
+
+    def test_concatenated_streams_are_parsed(self) -> None:
+        data = gzip.compress(b"1,a\n2,b\n") + gzip.compress(b"3,c\n")
+        result = fastnumbers.parse_compressed(io.BytesIO(data), usecol=0, block_size=5)
+        assert result.tolist() == [1.0, 2.0, 3.0]
+
+    def test_options_are_used(self) -> None:
+        data = gzip.compress(b"x\n1\nnan\nabc\n300")
+        result = fastnumbers.parse_compressed(
+            io.BytesIO(data), dtype=np.uint8, skip=1, on_fail=len, on_overflow=0
+        )
+        assert result.tolist() == [1, 3, 3, 0]
+
+    def test_empty_input_gives_empty_array(self) -> None:
+        assert fastnumbers.parse_compressed(io.BytesIO(b"")).tolist() == []
+
+    def test_uncompressed_input_raises(self) -> None:
+        with pytest.raises(ValueError, match="not gzip or zlib compressed"):
+            fastnumbers.parse_compressed(io.BytesIO(self.data))
+
+    def test_truncated_input_raises(self) -> None:
+        data = gzip.compress(self.data)[:-20]
+        with pytest.raises(EOFError):
+            fastnumbers.parse_compressed(io.BytesIO(data))
+
+    def test_corrupt_input_raises(self) -> None:
+        data = bytearray(gzip.compress(self.data))
+        data[20:30] = b"\xff" * 10
+        with pytest.raises(ValueError, match="compressed input is corrupt"):
+            fastnumbers.parse_compressed(io.BytesIO(data))
+
+    def test_block_size_must_be_positive(self) -> None:
+        with pytest.raises(ValueError, match="'block_size' must be positive"):
+            fastnumbers.parse_compressed(io.BytesIO(b""), block_size=0)
+
+    def test_parse_errors_are_raised(self) -> None:
+        data = gzip.compress(self.data + b"abc\n")
+        with pytest.raises(ValueError, match="Cannot convert 'abc'"):
+            fastnumbers.parse_compressed(io.BytesIO(data), block_size=100)
+
+
+class TestParseColumns:
+    def test_every_column_is_parsed_by_default(self) -> None:
+        result = fastnumbers.parse_columns(b"1,2.5,3\r\n\n4,5,6e1\r\n")
+        assert list(result) == [0, 1, 2]
+        assert [a.tolist() for a in result.values()] == [
+            [1.0, 4.0],
+            [2.5, 5.0],
+            [3.0, 60.0],
+        ]
+
+    def test_header_names_columns(self, tmp_path: pathlib.Path) -> None:
+        path = write(tmp_path, b"# comment\nx,\"y\",z\n1,2,3\n4,5,6")
+        result = fastnumbers.parse_columns(
+            path, skip=1, header=True, usecols=["z", 0], dtypes=[np.int8, np.uint16]
+        )
+        assert list(result) == ["z", "x"]
+        assert result["z"].dtype == np.int8
+        assert result["z"].tolist() == [3, 6]
+        assert result["x"].dtype == np.uint16
+        assert result["x"].tolist() == [1, 4]
+
+    def test_quoted_fields_may_contain_separators_and_newlines(self) -> None:
+        data = b'1,"2",x\n"3,5","a\n""b""",y\n'
+        given = []
+        result = fastnumbers.parse_columns(
+            data, usecols=[1, 0], on_fail=lambda x: given.append(x) or -1
+        )
+        assert result[1].tolist() == [2.0, -1.0]
+        assert result[0].tolist() == [1.0, -1.0]
+        assert given == ["3,5", 'a\n"b"']
+
+    def test_quoting_can_be_disabled(self) -> None:
+        result = fastnumbers.parse_columns(
+            b"'1'\t2\n", sep="\t", quotechar=None, on_fail=0
+        )
+        assert [a.tolist() for a in result.values()] == [[0.0], [2.0]]
+        result = fastnumbers.parse_columns(b"'1'\t2\n", sep=b"\t", quotechar="'")
+        assert [a.tolist() for a in result.values()] == [[1.0], [2.0]]
+
+    def test_replacements_and_masks_are_per_column(self) -> None:
+        data = b"1,1,1\nx,300,nan\n3\n"
+        result, masks = fastnumbers.parse_columns(
+            data,
+            dtypes=[np.float64, np.uint8, np.float64],
+            masks=True,
+            on_fail=[-1.0, 7, len],
+            on_overflow=255,
+            nan=[0.0, 0, -2.0],
+        )
+        assert result[0].tolist() == [1.0, -1.0, 3.0]
+        assert result[1].tolist() == [1, 255, 7]
+        assert result[2].tolist() == [1.0, -2.0, 0.0]
+        assert masks[0].tolist() == [True, False, True]
+        assert masks[1].tolist() == [True, False, False]
+        assert masks[2].tolist() == [True, True, False]
+
+    def test_failure_raises_by_default(self) -> None:
+        with pytest.raises(ValueError, match="Cannot convert 'x'"):
+            fastnumbers.parse_columns(b"1,x\n")
+        with pytest.raises(ValueError, match="Cannot convert ''"):
+            fastnumbers.parse_columns(b"1,2\n3\n")
+
+    def test_empty_text_gives_no_columns(self) -> None:
+        assert fastnumbers.parse_columns(b"") == {}
+        result = fastnumbers.parse_columns(b"a,b\n", header=True)
+        assert {k: v.tolist() for k, v in result.items()} == {"a": [], "b": []}
+
+    @pytest.mark.parametrize(
+        "kwargs, exception",
+        [
+            ({"sep": ",,"}, ValueError),
+            ({"quotechar": ""}, ValueError),
+            ({"usecols": ["a"]}, ValueError),
+            ({"usecols": [0, 0]}, ValueError),
+            ({"usecols": [-1]}, ValueError),
+            ({"dtypes": [np.float64]}, ValueError),
+            ({"on_fail": [1, 2, 3]}, ValueError),
+            ({"nan": fastnumbers.RAISE}, ValueError),
+        ],
+    )
+    def test_invalid_options_raise(self, kwargs: dict, exception: type) -> None:
+        with pytest.raises(exception):
+            fastnumbers.parse_columns(b"1,2\n", **kwargs)
+
+
+class TestParseFixedWidth:
+    def test_fields_are_parsed_from_each_line(self, tmp_path: pathlib.Path) -> None:
+        path = write(tmp_path, b"id  value\n   1 +2.5\r\n\n  20-3e1 \n")
+        ids, values = fastnumbers.parse_fixed_width(
+            path, [(0, 4), (4, 9)], skip=1, dtypes=[np.int16, None]
+        )
+        assert ids.dtype == np.int16
+        assert ids.tolist() == [1, 20]
+        assert values.dtype == np.float64
+        assert values.tolist() == [2.5, -30.0]
+
+    def test_records_may_be_at_a_fixed_stride(self) -> None:
+        data = bytearray(b"0102030405")
+        first, second = fastnumbers.parse_fixed_width(
+            data, [(0, 1), (1, 4)], record_length=4, dtypes=np.uint16
+        )
+        assert first.tolist() == [0, 0, 0]
+        assert second.tolist() == [102, 304, 5]
+
+    def test_fields_beyond_a_short_record_are_truncated(self) -> None:
+        result, masks = fastnumbers.parse_fixed_width(
+            b"123456\n12\n", [(0, 2), (2, 4), (4, 8)], masks=True, on_fail=[0, -1, -2]
+        )
+        assert [a.tolist() for a in result] == [[12, 12], [34, -1], [56, -2]]
+        assert [m.tolist() for m in masks] == [
+            [True, True],
+            [True, False],
+            [True, False],
+        ]
+
+    def test_fields_may_overlap(self) -> None:
+        result = fastnumbers.parse_fixed_width(
+            b"1234\n", [(0, 4), (1, 3), (2, 2)], on_fail=0
+        )
+        assert [a.tolist() for a in result] == [[1234.0], [23.0], [0.0]]
+
+    def test_callables_are_given_the_field(self) -> None:
+        result = fastnumbers.parse_fixed_width(
+            b" x1 y2\n", [(0, 3), (3, 6)], on_fail=lambda x: len(x), dtypes=np.int8
+        )
+        assert [a.tolist() for a in result] == [[3], [3]]
+
+    def test_failure_raises_by_default(self) -> None:
+        with pytest.raises(ValueError, match="Cannot convert ' x1'"):
+            fastnumbers.parse_fixed_width(b" x1 \n", [(0, 3)])
+        with pytest.raises(OverflowError):
+            fastnumbers.parse_fixed_width(b"300\n", [(0, 3)], dtypes=np.uint8)
+
+    def test_empty_text_gives_empty_arrays(self) -> None:
+        result = fastnumbers.parse_fixed_width(b"", [(0, 1)], dtypes=np.int32)
+        assert [a.tolist() for a in result] == [[]]
+        assert result[0].dtype == np.int32
+
+    @pytest.mark.parametrize(
+        "colspecs, kwargs",
+        [
+            ([(2, 1)], {}),
+            ([(-1, 1)], {}),
+            ([(0, 1, 2)], {}),
+            ([(0, 1)], {"record_length": 0}),
+            ([(0, 1)], {"dtypes": [np.float64, np.float64]}),
+            ([(0, 1)], {"on_fail": [1, 2]}),
+            ([(0, 1)], {"nan": fastnumbers.RAISE}),
+        ],
+    )
+    def test_invalid_options_raise(self, colspecs: list, kwargs: dict) -> None:
+        with pytest.raises(ValueError):
+            fastnumbers.parse_fixed_width(b"1\n", colspecs, **kwargs)
+
+
+class TestParseJsonNumbers:
+    @given(lists(floats(allow_nan=False, allow_infinity=False)))
+    def test_array_of_floats_matches_json(self, x: List[float]) -> None:
+        text = json.dumps(x)
+        result = fastnumbers.parse_json_numbers(text)
+        assert result.dtype == np.float64
+        assert result.tolist() == json.loads(text)
+
+    @given(lists(integers(min_value=-(2**63), max_value=2**63 - 1)))
+    def test_array_of_ints_matches_json(self, x: List[int]) -> None:
+        text = json.dumps(x).encode()
+        assert fastnumbers.parse_json_numbers(text, np.int64).tolist() == x
+
+    def test_nested_arrays_give_two_dimensions(self) -> None:
+        text = b" [ [1, 2.5e0 ,-3] ,\n\t[4E+1, 5e-1, 0.25] ] "
+        result = fastnumbers.parse_json_numbers(text)
+        assert result.shape == (2, 3)
+        assert result.tolist() == [[1.0, 2.5, -3.0], [40.0, 0.5, 0.25]]
+
+    @pytest.mark.parametrize(
+        "text, shape", [(b"[]", (0,)), (b"[[], []]", (2, 0)), (b"[[]]", (1, 0))]
+    )
+    def test_empty_arrays_give_empty_results(
+        self, text: bytes, shape: Tuple[int, ...]
+    ) -> None:
+        assert fastnumbers.parse_json_numbers(bytearray(text)).shape == shape
+
+    def test_null_is_replaced_or_masked(self) -> None:
+        text = b"[[1, null], [null, 300]]"
+        result, mask = fastnumbers.parse_json_numbers(
+            text,
+            np.uint8,
+            null=lambda x: 7 if x is None else 8,
+            on_overflow=9,
+            masks=True,
+        )
+        assert result.tolist() == [[1, 7], [7, 9]]
+        assert mask.tolist() == [[True, False], [False, False]]
+
+    def test_failures_are_handled_like_try_array(self) -> None:
+        with pytest.raises(TypeError):
+            fastnumbers.parse_json_numbers(b"[1, null]")
+        with pytest.raises(ValueError, match="Cannot convert '1.5'"):
+            fastnumbers.parse_json_numbers(b"[1.5]", np.int32)
+        result = fastnumbers.parse_json_numbers(b"[1.5, 1e1]", np.int32, on_fail=len)
+        assert result.tolist() == [3, 3]
+
+    @pytest.mark.parametrize(
+        "text, message",
+        [
+            (b"", "position 0: expected '\\['"),
+            (b"{}", "position 0: expected '\\['"),
+            (b"[1, 2", "position 5: expected ',' or '\\]'"),
+            (b"[1,]", "position 3: expected a number"),
+            (b"[01]", "position 2: expected ',' or '\\]'"),
+            (b"[+1]", "position 1: expected a number"),
+            (b"[.5]", "position 1: expected a number"),
+            (b"[1.]", "position 3: expected a digit after the decimal point"),
+            (b"[1e]", "position 3: expected a digit in the exponent"),
+            (b"[NaN]", "position 1: expected a number"),
+            (b'["1"]', "position 1: expected a number"),
+            (b"[[1], 2]", "position 6: expected an array"),
+            (b"[1, [2]]", "position 4: expected a number or null"),
+            (b"[[[1]]]", "position 2: arrays may only be nested one level"),
+            (b"[[1], [2, 3]]", "position 12: nested arrays must all have"),
+            (b"[1] 2", "position 4: unexpected text after the array"),
+        ],
+    )
+    def test_invalid_json_raises(self, text: bytes, message: str) -> None:
+        with pytest.raises(ValueError, match=message):
+            fastnumbers.parse_json_numbers(text)
+
+
+class TestFindNumbers:
+    @given(lists(floats(allow_nan=False, allow_infinity=False)))
+    def test_finds_floats_separated_by_text(self, x: List[float]) -> None:
+        text = " and ".join(map(repr, x))
+        assert fastnumbers.find_numbers(text, "float") == x
+
+    @given(lists(integers()))
+    def test_finds_ints_separated_by_text(self, x: List[int]) -> None:
+        text = "x".join(map(str, x))
+        assert fastnumbers.find_numbers(text, "int") == x
+
+    @pytest.mark.parametrize(
+        "text, kind, expected",
+        [
+            ("", "real", []),
+            ("no numbers", "real", []),
+            ("took 12.5ms for 3 rows", "real", [12.5, 3]),
+            ("took 12.5ms for 3 rows", "float", [12.5, 3.0]),
+            ("took 12.5ms for 3 rows", "int", [12, 5, 3]),
+            ("1.2.3", "real", [1.2, 0.3]),
+            ("5. and .5", "real", [5.0, 0.5]),
+            ("1e3 1e 1e+", "real", [1000.0, 1, 1]),
+            ("-1+2", "real", [-1, 2]),
+            ("٣.٥", "real", [3.5]),
+        ],
+    )
+    def test_kinds(self, text: str, kind: str, expected: List[float]) -> None:
+        result = fastnumbers.find_numbers(text, kind)
+        assert result == expected
+        assert list(map(type, result)) == list(map(type, expected))
+
+    def test_large_ints_do_not_overflow(self) -> None:
+        assert fastnumbers.find_numbers("x" + "9" * 30) == [int("9" * 30)]
+
+    def test_options(self) -> None:
+        assert fastnumbers.find_numbers("2024-01-02") == [2024, -1, -2]
+        assert fastnumbers.find_numbers("2024-01-02", signed=False) == [2024, 1, 2]
+        assert fastnumbers.find_numbers("1e5", exp=False) == [1, 5]
+
+    def test_offsets(self) -> None:
+        text = "x=1, y=-2.5"
+        expected = [(1, 2, 3), (-2.5, 7, 11)]
+        assert fastnumbers.find_numbers(text, offsets=True) == expected
+        assert [text[start:end] for _, start, end in expected] == ["1", "-2.5"]
+
+    def test_map(self) -> None:
+        texts = ["a1", "b2c3", ""]
+        expected = [[1], [2, 3], []]
+        assert fastnumbers.find_numbers(texts, map=list) == expected
+        assert list(fastnumbers.find_numbers(iter(texts), map=True)) == expected
+
+    def test_errors(self) -> None:
+        with pytest.raises(TypeError, match="only search str, not bytes"):
+            fastnumbers.find_numbers(b"1")  # type: ignore[call-overload]
+        with pytest.raises(TypeError, match="only search str, not int"):
+            fastnumbers.find_numbers(["1", 2], map=list)  # type: ignore[list-item]
+        with pytest.raises(ValueError, match="kind must be one of"):
+            fastnumbers.find_numbers("1", "complex")  # type: ignore[call-overload]